@@ -1,21 +0,0 @@
-//
-//  BluetoothDriverKit.h
-//  BluetoothDriverKit
-//
-//  Created by Ravi Parupudi on 12/8/20.
-//
-
-
-#ifndef BluetoothDriverKit_h
-#define BluetoothDriverKit_h
-
-//! Project version number for BluetoothDriverKit.
-//FOUNDATION_EXPORT double BluetoothDriverKitVersionNumber;
-
-//! Project version string for BluetoothDriverKit.
-//FOUNDATION_EXPORT const unsigned char BluetoothDriverKitVersionString[];
-
-
-#include <BluetoothDriverKit/IOBluetoothHIDChannel.h>
-
-#endif
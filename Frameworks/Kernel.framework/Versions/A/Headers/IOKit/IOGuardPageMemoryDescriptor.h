@@ -1,70 +0,0 @@
-/*
- * Copyright (c) 1998-2020 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-
-#ifndef _IOGUARDPAGEMEMORYDESCRIPTOR_H
-#define _IOGUARDPAGEMEMORYDESCRIPTOR_H
-
-#include <IOKit/IOMemoryDescriptor.h>
-#include <libkern/c++/OSPtr.h>
-
-/*!
- *   @class IOGuardPageMemoryDescriptor
- *   @abstract Provides a memory descriptor that allows for variable size guard regions. Use with
- *             IOMultiMemoryDescriptor to surround other memory descriptors with guard pages.
- */
-class IOGuardPageMemoryDescriptor : public IOGeneralMemoryDescriptor
-{
-	OSDeclareDefaultStructors(IOGuardPageMemoryDescriptor);
-
-protected:
-	virtual void free() APPLE_KEXT_OVERRIDE;
-
-	vm_offset_t    _buffer;
-	vm_size_t      _size;
-
-public:
-
-	/* @function withSize
-	 *  @discussion Create a IOGuardPageMemoryDescriptor with the specified size.
-	 *  @param Size of the guard region. This will be rounded up to the nearest multiple of page size.
-	 *  @return IOGuardPageMemoryDescriptor instance to be released by the caller, which will free the allocated
-	 *          virtual memory region.
-	 */
-	static OSPtr<IOGuardPageMemoryDescriptor> withSize(vm_size_t size);
-
-	virtual bool initWithSize(vm_size_t size);
-
-private:
-	virtual IOReturn doMap(vm_map_t           addressMap,
-	    IOVirtualAddress * atAddress,
-	    IOOptionBits       options,
-	    IOByteCount        sourceOffset = 0,
-	    IOByteCount        length = 0 ) APPLE_KEXT_OVERRIDE;
-};
-
-#endif /* !_IOGUARDPAGEMEMORYDESCRIPTOR_H */
@@ -1,50 +0,0 @@
-/*
-* Copyright (c) 1998-2019 Apple Inc. All rights reserved.
-*
-* @APPLE_LICENSE_HEADER_START@
-*
-* This file contains Original Code and/or Modifications of Original Code
-* as defined in and that are subject to the Apple Public Source License
-* Version 2.0 (the 'License'). You may not use this file except in
-* compliance with the License. Please obtain a copy of the License at
-* http://www.opensource.apple.com/apsl/ and read it before using this
-* file.
-*
-* The Original Code and all software distributed under the License are
-* distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
-* EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
-* INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
-* FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
-* Please see the License for the specific language governing rights and
-* limitations under the License.
-*
-* @APPLE_LICENSE_HEADER_END@
-*/
-
-#ifndef IOBlockStoragePerfControlExports_h
-#define IOBlockStoragePerfControlExports_h
-
-#include <IOKit/perfcontrol/IOPerfControl.h>
-
-#define IOBlockStorageWorkArgsVersion2        2
-#define IOBlockStorageCurrentWorkArgsVersion  IOBlockStorageWorkArgsVersion2
-
-struct IOBlockStorageWorkFlags
-{
-    /* isRead is True for read op */
-    bool isRead{};
-
-    /* isLowPriority is True for low priority IOs */
-    bool isLowPriority{};
-
-    /* Size of the I/O in bytes */
-    uint64_t ioSize{};
-};
-
-struct IOBlockStorageWorkEndArgs
-{
-    /* Timestamp taken after the completion handler has finished */
-    uint64_t postCompletionTime;
-};
-
-#endif /* IOBlockStoragePerfControlExports_h */
@@ -1,13 +0,0 @@
-/*
- *  Copyright 2006 Apple Computer, Inc. All rights reserved.
- *
- */
-
-#ifndef __IOKIT_IOSTREAMFAMILY_H
-#define __IOKIT_IOSTREAMFAMILY_H
-
-#include <IOKit/stream/IOStream.h>
-#include <IOKit/stream/IOStreamShared.h>
-
-
-#endif /* !__IOKIT_IOSTREAMFAMILY_H */
@@ -1 +0,0 @@
-#include <DriverKit/IOBlockStorageDevice.h>
@@ -1 +0,0 @@
-#include <DriverKit/IOBufferMemoryDescriptor.h>
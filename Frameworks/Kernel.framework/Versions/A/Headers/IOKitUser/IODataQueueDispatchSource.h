@@ -1 +0,0 @@
-#include <DriverKit/IODataQueueDispatchSource.h>
@@ -1 +0,0 @@
-#include <DriverKit/IODispatchQueue.h>
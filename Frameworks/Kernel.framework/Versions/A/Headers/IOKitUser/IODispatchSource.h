@@ -1 +0,0 @@
-#include <DriverKit/IODispatchSource.h>
@@ -1 +0,0 @@
-#include <DriverKit/IOInterruptDispatchSource.h>
@@ -1 +0,0 @@
-#include <DriverKit/IOMemoryDescriptor.h>
@@ -1 +0,0 @@
-#include <DriverKit/IOMemoryMap.h>
@@ -1 +0,0 @@
-#include <DriverKit/IOService.h>
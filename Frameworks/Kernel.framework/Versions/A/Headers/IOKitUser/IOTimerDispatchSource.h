@@ -1 +0,0 @@
-#include <DriverKit/IOTimerDispatchSource.h>
@@ -1 +0,0 @@
-#include <DriverKit/IOUserServer.h>
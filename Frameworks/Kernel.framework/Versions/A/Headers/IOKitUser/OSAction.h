@@ -1 +0,0 @@
-#include <DriverKit/OSAction.h>
@@ -1 +0,0 @@
-#include <DriverKit/OSArray.h>
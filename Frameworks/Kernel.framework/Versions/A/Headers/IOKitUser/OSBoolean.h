@@ -1 +0,0 @@
-#include <DriverKit/OSBoolean.h>
@@ -1 +0,0 @@
-#include <DriverKit/OSCollection.h>
@@ -1 +0,0 @@
-#include <DriverKit/OSContainer.h>
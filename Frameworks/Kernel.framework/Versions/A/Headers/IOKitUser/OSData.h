@@ -1 +0,0 @@
-#include <DriverKit/OSData.h>
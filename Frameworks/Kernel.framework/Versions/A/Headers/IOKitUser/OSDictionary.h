@@ -1 +0,0 @@
-#include <DriverKit/OSDictionary.h>
@@ -1 +0,0 @@
-#include <DriverKit/OSNumber.h>
@@ -1 +0,0 @@
-#include <DriverKit/OSObject.h>
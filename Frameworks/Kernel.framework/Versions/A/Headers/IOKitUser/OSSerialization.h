@@ -1 +0,0 @@
-#include <DriverKit/OSSerialization.h>
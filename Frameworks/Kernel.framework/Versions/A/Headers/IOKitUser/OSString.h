@@ -1 +0,0 @@
-#include <DriverKit/OSString.h>
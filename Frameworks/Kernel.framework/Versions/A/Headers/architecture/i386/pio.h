@@ -1,109 +0,0 @@
-/*
- * Copyright (c) 2000-2005 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- * 
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- * 
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- * 
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- * 
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/*
- * @OSF_COPYRIGHT@
- */
-/* 
- * Mach Operating System
- * Copyright (c) 1991,1990 Carnegie Mellon University
- * All Rights Reserved.
- * 
- * Permission to use, copy, modify and distribute this software and its
- * documentation is hereby granted, provided that both the copyright
- * notice and this permission notice appear in all copies of the
- * software, derivative works or modified versions, and any portions
- * thereof, and that both notices appear in supporting documentation.
- * 
- * CARNEGIE MELLON ALLOWS FREE USE OF THIS SOFTWARE IN ITS "AS IS"
- * CONDITION.  CARNEGIE MELLON DISCLAIMS ANY LIABILITY OF ANY KIND FOR
- * ANY DAMAGES WHATSOEVER RESULTING FROM THE USE OF THIS SOFTWARE.
- * 
- * Carnegie Mellon requests users of this software to return to
- * 
- *  Software Distribution Coordinator  or  Software.Distribution@CS.CMU.EDU
- *  School of Computer Science
- *  Carnegie Mellon University
- *  Pittsburgh PA 15213-3890
- * 
- * any improvements or extensions that they make and grant Carnegie Mellon
- * the rights to redistribute these changes.
- */
-/* 
- */
-#ifndef _ARCH_I386_PIO_H_
-#define _ARCH_I386_PIO_H_
-
-typedef unsigned short i386_ioport_t;
-
-#if defined(__GNUC__)
-static __inline__ unsigned int	inl(
-				i386_ioport_t port)
-{
-	unsigned int datum;
-	__asm__ volatile("inl %w1, %0" : "=a" (datum) : "Nd" (port));
-	return(datum);
-}
-
-static __inline__ unsigned short inw(
-				i386_ioport_t port)
-{
-	unsigned short datum;
-	__asm__ volatile("inw %w1, %w0" : "=a" (datum) : "Nd" (port));
-	return(datum);
-}
-
-static __inline__ unsigned char inb(
-				i386_ioport_t port)
-{
-	unsigned char datum;
-	__asm__ volatile("inb %w1, %b0" : "=a" (datum) : "Nd" (port));
-	return(datum);
-}
-
-static __inline__ void outl(
-				i386_ioport_t port,
-				unsigned int datum)
-{
-	__asm__ volatile("outl %0, %w1" : : "a" (datum), "Nd" (port));
-}
-
-static __inline__ void outw(
-				i386_ioport_t port,
-				unsigned short datum)
-{
-	__asm__ volatile("outw %w0, %w1" : : "a" (datum), "Nd" (port));
-}
-
-static __inline__ void outb(
-				i386_ioport_t port,
-				unsigned char datum)
-{
-	__asm__ volatile("outb %b0, %w1" : : "a" (datum), "Nd" (port));
-}
-#endif /* defined(__GNUC__) */
-#endif /* _ARCH_I386_PIO_H_ */
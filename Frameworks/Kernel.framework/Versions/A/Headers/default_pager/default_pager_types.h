@@ -1,56 +0,0 @@
-/*
- * Copyright (c) 2000-2004 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/*
- * @OSF_COPYRIGHT@
- */
-
-
-#ifndef _MACH_DEFAULT_PAGER_TYPES_H_
-#define _MACH_DEFAULT_PAGER_TYPES_H_
-
-#include <sys/appleapiopts.h>
-
-#ifdef __APPLE_API_UNSTABLE
-
-#include <mach/mach_types.h>
-#include <mach/machine/vm_types.h>
-#include <mach/memory_object_types.h>
-
-#define HI_WAT_ALERT            0x01
-#define LO_WAT_ALERT            0x02
-#define SWAP_ENCRYPT_ON         0x04
-#define SWAP_ENCRYPT_OFF        0x08
-#define SWAP_COMPACT_DISABLE    0x10
-#define SWAP_COMPACT_ENABLE     0x20
-#define PROC_RESUME             0x40
-#define SWAP_FILE_CREATION_ERROR        0x80
-#define USE_EMERGENCY_SWAP_FILE_FIRST   0x100
-
-#endif /* __APPLE_API_UNSTABLE */
-
-#endif  /* _MACH_DEFAULT_PAGER_TYPES_H_ */
@@ -1,72 +0,0 @@
-/*
- * Copyright (c) 2000-2019 Apple Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/*
- * @OSF_COPYRIGHT@
- */
-
-#ifndef _I386_MACHINE_ROUTINES_H_
-#define _I386_MACHINE_ROUTINES_H_
-
-#include <mach/mach_types.h>
-#include <mach/boolean.h>
-#include <kern/kern_types.h>
-#include <pexpert/pexpert.h>
-
-#include <sys/cdefs.h>
-#include <sys/appleapiopts.h>
-
-#include <stdarg.h>
-
-__BEGIN_DECLS
-
-
-
-/* Get Interrupts Enabled */
-boolean_t ml_get_interrupts_enabled(void);
-
-/* Set Interrupts Enabled */
-boolean_t ml_set_interrupts_enabled(boolean_t enable);
-#define ml_set_interrupts_enabled_with_debug(en, dbg) ml_set_interrupts_enabled(en);
-boolean_t ml_early_set_interrupts_enabled(boolean_t enable);
-
-/* Check if running at interrupt context */
-boolean_t ml_at_interrupt_context(void);
-
-
-/* Zero bytes starting at a physical address */
-void bzero_phys(
-	addr64_t phys_address,
-	uint32_t length);
-
-/* Bytes available on current stack */
-vm_offset_t ml_stack_remaining(void);
-
-
-__END_DECLS
-
-#endif /* _I386_MACHINE_ROUTINES_H_ */
@@ -1,58 +0,0 @@
-/*
- * Copyright (c) 2000-2002 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/*
- * Copyright (c) 1997, Apple Computer, Inc. All rights reserved.
- *
- */
-
-#ifndef _BSD_I386_PROFILE_H_
-#define _BSD_I386_PROFILE_H_
-
-#if defined (__i386__) || defined (__x86_64__)
-
-#include <sys/appleapiopts.h>
-
-#ifdef __APPLE_API_UNSTABLE
-
-/*
- * Block interrupts during mcount so that those interrupts can also be
- * counted (as soon as we get done with the current counting).  On the
- * i386 platfom, can't do splhigh/splx as those are C routines and can
- * recursively invoke mcount.
- */
-#warning MCOUNT_* not implemented yet.
-
-#define MCOUNT_INIT
-#define MCOUNT_ENTER    /* s = splhigh(); */ /* XXX TODO */
-#define MCOUNT_EXIT     /* (void) splx(s); */ /* XXX TODO */
-
-#endif /* __APPLE_API_UNSTABLE */
-
-#endif /* defined (__i386__) || defined (__x86_64__) */
-
-#endif /* _BSD_I386_PROFILE_H_ */
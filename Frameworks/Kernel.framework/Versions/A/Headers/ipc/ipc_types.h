@@ -1,57 +0,0 @@
-/*
- * Copyright (c) 2000-2005 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/*
- * @OSF_COPYRIGHT@
- */
-
-/*
- * Define Basic IPC types available to callers.
- * These are not intended to be used directly, but
- * are used to define other types available through
- * port.h and mach_types.h for in-kernel entities.
- */
-
-#ifndef _IPC_IPC_TYPES_H_
-#define _IPC_IPC_TYPES_H_
-
-#include <mach/port.h>
-#include <mach/message.h>
-#include <mach/mach_types.h>
-
-
-struct ipc_object;
-
-
-typedef struct ipc_object       *ipc_object_t;
-
-#define IPC_OBJECT_NULL         ((ipc_object_t) 0)
-#define IPC_OBJECT_DEAD         ((ipc_object_t)~0)
-#define IPC_OBJECT_VALID(io)    (((io) != IPC_OBJECT_NULL) && \
-	                         ((io) != IPC_OBJECT_DEAD))
-
-#endif  /* _IPC_IPC_TYPES_H_ */
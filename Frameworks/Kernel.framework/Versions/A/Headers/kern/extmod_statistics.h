@@ -1,46 +0,0 @@
-/*
- * Copyright (c) 2011 Apple Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/*
- *	kern/extmod_statistics.h
- *
- *	Definitions for statistics related to external
- *  modification of a task by another agent on the system.
- *
- */
-
-#ifndef _KERN_EXTMOD_STATISTICS_H_
-#define _KERN_EXTMOD_STATISTICS_H_
-
-#include <kern/task.h>
-#include <mach/vm_types.h>
-
-extern void extmod_statistics_incr_task_for_pid(task_t target);
-extern void extmod_statistics_incr_thread_set_state(thread_t target);
-extern void extmod_statistics_incr_thread_create(task_t target);
-
-#endif  /* _KERN_EXTMOD_STATISTICS_H_ */
@@ -1,116 +0,0 @@
-/*
- * Copyright (c) 2003-2019 Apple Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-
-#ifndef _KERN_LOCKS_H_
-#define _KERN_LOCKS_H_
-
-#include <sys/cdefs.h>
-#include <sys/appleapiopts.h>
-
-#include <mach/boolean.h>
-#include <machine/locks.h>
-
-#include <kern/assert.h>
-#include <kern/kern_types.h>
-#include <kern/lock_attr.h>
-#include <kern/lock_group.h>
-#include <kern/lock_mtx.h>
-#include <kern/lock_rw.h>
-#include <kern/lock_types.h>
-
-__BEGIN_DECLS
-
-#define decl_lck_spin_data(class, name)     class lck_spin_t name
-
-extern lck_spin_t      *lck_spin_alloc_init(
-	lck_grp_t               *grp,
-	lck_attr_t              *attr);
-
-extern void             lck_spin_init(
-	lck_spin_t              *lck,
-	lck_grp_t               *grp,
-	lck_attr_t              *attr);
-
-extern void             lck_spin_lock(
-	lck_spin_t              *lck);
-
-extern void             lck_spin_lock_grp(
-	lck_spin_t              *lck,
-	lck_grp_t               *grp);
-
-extern void             lck_spin_unlock(
-	lck_spin_t              *lck);
-
-extern void             lck_spin_destroy(
-	lck_spin_t              *lck,
-	lck_grp_t               *grp);
-
-extern void             lck_spin_free(
-	lck_spin_t              *lck,
-	lck_grp_t               *grp);
-
-extern wait_result_t    lck_spin_sleep(
-	lck_spin_t              *lck,
-	lck_sleep_action_t      lck_sleep_action,
-	event_t                 event,
-	wait_interrupt_t        interruptible);
-
-extern wait_result_t    lck_spin_sleep_grp(
-	lck_spin_t              *lck,
-	lck_sleep_action_t      lck_sleep_action,
-	event_t                 event,
-	wait_interrupt_t        interruptible,
-	lck_grp_t               *grp);
-
-extern wait_result_t    lck_spin_sleep_deadline(
-	lck_spin_t              *lck,
-	lck_sleep_action_t      lck_sleep_action,
-	event_t                 event,
-	wait_interrupt_t        interruptible,
-	uint64_t                deadline);
-
-
-#if MACH_ASSERT
-#define LCK_SPIN_ASSERT(lck, type) MACH_ASSERT_DO(lck_spin_assert(lck, type))
-#else /* !MACH_ASSERT */
-#define LCK_SPIN_ASSERT(lck, type)
-#endif /* !MACH_ASSERT */
-
-#if DEBUG
-#define LCK_SPIN_ASSERT_DEBUG(lck, type) lck_spin_assert((lck),(type))
-#else /* DEBUG */
-#define LCK_SPIN_ASSERT_DEBUG(lck, type)
-#endif /* DEBUG */
-
-#define LCK_ASSERT_OWNED                1
-#define LCK_ASSERT_NOTOWNED             2
-
-
-__END_DECLS
-
-#endif /* _KERN_LOCKS_H_ */
@@ -1,61 +0,0 @@
-/*
- * Copyright (c) 1999-2024 Apple Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-#ifndef DLIL_H
-#define DLIL_H
-
-#include <sys/kernel_types.h>
-#include <net/kpi_interface.h>
-
-enum {
-	BPF_TAP_DISABLE,
-	BPF_TAP_INPUT,
-	BPF_TAP_OUTPUT,
-	BPF_TAP_INPUT_OUTPUT
-};
-
-/*
- * DLIL_DESC_ETYPE2 - native_type must point to 2 byte ethernet raw protocol,
- *                    variants.native_type_length must be set to 2
- * DLIL_DESC_SAP - native_type must point to 3 byte SAP protocol
- *                 variants.native_type_length must be set to 3
- * DLIL_DESC_SNAP - native_type must point to 5 byte SNAP protocol
- *                  variants.native_type_length must be set to 5
- *
- * All protocols must be in Network byte order.
- *
- * Future interface families may define more protocol types they know about.
- * The type implies the offset and context of the protocol data at native_type.
- * The length of the protocol data specified at native_type must be set in
- * variants.native_type_length.
- */
-/* Ethernet specific types */
-#define DLIL_DESC_ETYPE2        4
-#define DLIL_DESC_SAP           5
-#define DLIL_DESC_SNAP          6
-
-#endif /* DLIL_H */
@@ -1,83 +0,0 @@
-/*===---- stddef.h - Basic type definitions --------------------------------===
- *
- * Copyright (c) 2008 Eli Friedman
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
- * THE SOFTWARE.
- *
- *===-----------------------------------------------------------------------===
- */
-
-#if (defined(__has_include) && __has_include(<__xnu_libcxx_sentinel.h>) && !defined(XNU_LIBCXX_SDKROOT))
-
-#if !__has_include_next(<stddef.h>)
-#error Do not build with -nostdinc (use GCC_USE_STANDARD_INCLUDE_SEARCHING=NO)
-#endif /* __has_include_next */
-
-#include_next <stddef.h>
-
-#else /* (defined(__has_include) && __has_include(<__xnu_libcxx_sentinel.h>) && !defined(XNU_LIBCXX_SDKROOT)) */
-
-#ifndef __STDDEF_H
-#define __STDDEF_H
-
-#undef NULL
-#ifdef __cplusplus
-#if __cplusplus >= 201103L
-#define NULL nullptr
-#else
-#undef __null  // VC++ hack.
-#define NULL __null
-#endif
-#else
-#define NULL ((void*)0)
-#endif
-
-#ifndef _PTRDIFF_T
-#define _PTRDIFF_T
-typedef __typeof__(((int*)NULL) - ((int*)NULL)) ptrdiff_t;
-#endif
-#ifndef _SIZE_T
-#define _SIZE_T
-typedef __typeof__(sizeof(int)) size_t;
-#endif
-#ifndef __cplusplus
-#ifndef _WCHAR_T
-#define _WCHAR_T
-typedef __WCHAR_TYPE__ wchar_t;
-#endif
-#endif
-
-#ifndef offsetof
-#define offsetof(t, d) __builtin_offsetof(t, d)
-#endif
-
-#endif /* __STDDEF_H */
-
-/* Some C libraries expect to see a wint_t here. Others (notably MinGW) will
- * use __WINT_TYPE__ directly; accommodate both by requiring __need_wint_t
- */
-#if defined(__need_wint_t)
-#if !defined(_WINT_T)
-#define _WINT_T
-typedef __WINT_TYPE__ wint_t;
-#endif /* _WINT_T */
-#undef __need_wint_t
-#endif /* __need_wint_t */
-
-#endif
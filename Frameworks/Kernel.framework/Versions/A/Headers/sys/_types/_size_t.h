@@ -1,56 +0,0 @@
-/*
- * Copyright (c) 2003-2012 Apple Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-#define USE_CLANG_STDDEF 0
-
-#if USE_CLANG_STDDEF
-
-#ifndef __SIZE_T
-#define __SIZE_T
-
-#define __need_size_t
-#include <stddef.h>
-#undef __need_size_t
-
-#endif  /* __SIZE_T */
-
-#else
-
-#ifndef _SIZE_T
-#define _SIZE_T
-#include <machine/_types.h> /* __darwin_size_t */
-typedef __darwin_size_t        size_t;
-#endif  /* _SIZE_T */
-
-#endif
-
-#if !defined(_SIZE_UT) && !defined(VM_UNSAFE_TYPES)
-#define _SIZE_UT
-typedef __typeof__(sizeof(int)) size_ut;
-#endif /*  !defined(_SIZE_UT) && !defined(VM_UNSAFE_TYPES) */
-
-#undef USE_CLANG_STDDEF
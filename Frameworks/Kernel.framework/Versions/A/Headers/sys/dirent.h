@@ -1,143 +0,0 @@
-/*
- * Copyright (c) 2000-2008, 2023 Apple Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/* Copyright (c) 1995 NeXT Computer, Inc. All Rights Reserved */
-/*-
- * Copyright (c) 1989, 1993
- *	The Regents of the University of California.  All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions
- * are met:
- * 1. Redistributions of source code must retain the above copyright
- *    notice, this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright
- *    notice, this list of conditions and the following disclaimer in the
- *    documentation and/or other materials provided with the distribution.
- * 3. All advertising materials mentioning features or use of this software
- *    must display the following acknowledgement:
- *	This product includes software developed by the University of
- *	California, Berkeley and its contributors.
- * 4. Neither the name of the University nor the names of its contributors
- *    may be used to endorse or promote products derived from this software
- *    without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS ``AS IS'' AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
- * ARE DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE
- * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
- * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
- * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
- * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
- * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
- * SUCH DAMAGE.
- *
- *	@(#)dirent.h	8.3 (Berkeley) 8/10/94
- */
-
-/*
- * The dirent structure defines the format of directory entries.
- *
- * A directory entry has a struct dirent at the front of it, containing its
- * inode number, the length of the entry, and the length of the name
- * contained in the entry.  These are followed by the name padded to a 4
- * byte boundary with null bytes.  All names are guaranteed null terminated.
- * The maximum length of a name in a directory is MAXNAMLEN when 32-bit
- * ino_t is in effect; (MAXPATHLEN - 1) when 64-bit ino_t is in effect.
- */
-
-#ifndef _SYS_DIRENT_H
-#define _SYS_DIRENT_H
-
-#include <sys/_types.h>
-#include <sys/cdefs.h>
-
-#include <sys/_types/_ino_t.h>
-
-
-#define __DARWIN_MAXNAMLEN      255
-
-#pragma pack(4)
-
-#if !__DARWIN_64_BIT_INO_T
-struct dirent {
-	ino_t d_ino;                    /* file number of entry */
-	__uint16_t d_reclen;            /* length of this record */
-	__uint8_t  d_type;              /* file type, see below */
-	__uint8_t  d_namlen;            /* length of string in d_name */
-	char d_name[__DARWIN_MAXNAMLEN + 1];    /* name must be no longer than this */
-};
-#endif /* !__DARWIN_64_BIT_INO_T */
-
-#pragma pack()
-
-#define __DARWIN_MAXPATHLEN     1024
-
-#define __DARWIN_STRUCT_DIRENTRY { \
-	__uint64_t  d_ino;      /* file number of entry */ \
-	__uint64_t  d_seekoff;  /* seek offset (optional, used by servers) */ \
-	__uint16_t  d_reclen;   /* length of this record */ \
-	__uint16_t  d_namlen;   /* length of string in d_name */ \
-	__uint8_t   d_type;     /* file type, see below */ \
-	char      d_name[__DARWIN_MAXPATHLEN]; /* entry name (up to MAXPATHLEN bytes) */ \
-}
-
-#if __DARWIN_64_BIT_INO_T
-struct dirent __DARWIN_STRUCT_DIRENTRY;
-#endif /* __DARWIN_64_BIT_INO_T */
-
-/* Extended directory entry */
-struct direntry __DARWIN_STRUCT_DIRENTRY;
-
-
-#if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
-#define d_fileno        d_ino           /* backward compatibility */
-#define MAXNAMLEN       __DARWIN_MAXNAMLEN
-/*
- * File types
- */
-#define DT_UNKNOWN       0
-#define DT_FIFO          1
-#define DT_CHR           2
-#define DT_DIR           4
-#define DT_BLK           6
-#define DT_REG           8
-#define DT_LNK          10
-#define DT_SOCK         12
-#define DT_WHT          14
-
-/*
- * Convert between stat structure types and directory types.
- */
-#define IFTODT(mode)    (((mode) & 0170000) >> 12)
-#define DTTOIF(dirtype) ((dirtype) << 12)
-#endif
-
-
-#endif /* _SYS_DIRENT_H  */
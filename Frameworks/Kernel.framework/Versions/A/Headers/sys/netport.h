@@ -1,54 +0,0 @@
-/*
- * Copyright (c) 2000 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-/* Copyright (c) 1995 NeXT Computer, Inc. All Rights Reserved */
-/*
- * Copyright (c) 1987,1988,1989 Carnegie-Mellon University All rights reserved.
- */
-#ifndef _SYS_NETPORT_H_
-#define _SYS_NETPORT_H_
-
-#include <_types/_uint32_t.h> /* uint32_t */
-
-typedef uint32_t        netaddr_t;
-
-/*
- * Network Port structure.
- */
-typedef struct {
-	long        np_uid_high;
-	long        np_uid_low;
-} np_uid_t;
-
-typedef struct {
-	netaddr_t   np_receiver;
-	netaddr_t   np_owner;
-	np_uid_t    np_puid;
-	np_uid_t    np_sid;
-} network_port_t;
-
-#endif  /* !_SYS_NETPORT_H_ */
@@ -1,43 +0,0 @@
-/*
- * Copyright (c) 1999, 2000-2005 Apple Computer, Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-
-#ifndef __SYS_RANDOM_H__
-#define __SYS_RANDOM_H__
-
-#include <sys/appleapiopts.h>
-#include <sys/cdefs.h>
-
-#ifdef __APPLE_API_UNSTABLE
-__BEGIN_DECLS
-void read_random(void* buffer, u_int numBytes);
-void read_frandom(void* buffer, u_int numBytes);
-int  write_random(void* buffer, u_int numBytes);
-__END_DECLS
-#endif /* __APPLE_API_UNSTABLE */
-
-#endif /* __SYS_RANDOM_H__ */
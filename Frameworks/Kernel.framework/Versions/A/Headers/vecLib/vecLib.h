@@ -1,33 +0,0 @@
-/*
-     File:       vecLib/vecLib.h
- 
-     Contains:   Master include for vecLib framework
- 
-     Version:    vecLib-1068.100
- 
-     Copyright:  Copyright (c) 2000-2025 by Apple Inc. All rights reserved.
- 
-     Bugs:       For bug reports, consult the following page on
-                 the World Wide Web:
- 
-                     http://developer.apple.com/bugreporter/
- 
-*/
-#ifndef __VECLIB__
-#define __VECLIB__
-
-#ifndef __VECLIBTYPES__
-#include <vecLib/vecLibTypes.h>
-#endif
-#ifndef __VBASICOPS__
-#include <vecLib/vBasicOps.h>
-#endif
-
-#ifndef __VDSP__
-#include <vecLib/vDSP.h>
-#endif
-#ifndef __VFORCE_H
-#include <vecLib/vForce.h>
-#endif
-
-#endif /* __VECLIB__ */
@@ -1,42 +0,0 @@
-/*
- * Copyright (c) 2012-2016 Apple Inc. All rights reserved.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_START@
- *
- * This file contains Original Code and/or Modifications of Original Code
- * as defined in and that are subject to the Apple Public Source License
- * Version 2.0 (the 'License'). You may not use this file except in
- * compliance with the License. The rights granted to you under the License
- * may not be used to create, or enable the creation or redistribution of,
- * unlawful or unlicensed copies of an Apple operating system, or to
- * circumvent, violate, or enable the circumvention or violation of, any
- * terms of an Apple operating system software license agreement.
- *
- * Please obtain a copy of the License at
- * http://www.opensource.apple.com/apsl/ and read it before using this file.
- *
- * The Original Code and all software distributed under the License are
- * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
- * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
- * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
- * Please see the License for the specific language governing rights and
- * limitations under the License.
- *
- * @APPLE_OSREFERENCE_LICENSE_HEADER_END@
- */
-
-#ifndef _VOUCHER_IPC_PTHREAD_PRIORITY_TYPES_H_
-#define _VOUCHER_IPC_PTHREAD_PRIORITY_TYPES_H_
-
-#include <stdint.h>
-#include <mach/mach_types.h>
-
-#define MACH_VOUCHER_ATTR_PTHPRIORITY_NULL              ((mach_voucher_attr_recipe_command_t)701)
-#define MACH_VOUCHER_ATTR_PTHPRIORITY_CREATE            ((mach_voucher_attr_recipe_command_t)710)
-
-typedef uint32_t ipc_pthread_priority_value_t;
-
-#define MACH_VOUCHER_PTHPRIORITY_CONTENT_SIZE (sizeof(ipc_pthread_priority_value_t))
-
-#endif /* _VOUCHER_IPC_PTHREAD_PRIORITY_TYPES_H_ */
@@ -0,0 +1,42 @@
+#!/usr/bin/env bash
+# Times preprocessing the Cocoa, Metal and CoreText umbrellas with and
+# without the availability headers specialized for the target (see
+# src/specialize_availability.zig), and prints how much text each one
+# reads and how many conditionals it evaluates.
+#
+# Usage: bench/availability.sh [arch] [min-macos] [runs]
+set -euo pipefail
+
+arch=${1:-aarch64}
+min=${2:-13.0}
+runs=${3:-10}
+target=$arch-macos.$min
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+zig run -OReleaseSafe --dep dep_file -Mroot="$root/src/specialize_availability.zig" \
+  -OReleaseSafe -Mdep_file="$root/src/dep_file.zig" -- \
+  "$work/availability" "$work/availability.d" "$root/include" "$arch" "$min"
+
+printf '%-20s %-12s %12s %8s %10s\n' umbrella headers bytes '#ifs' ms/run
+for umbrella in Cocoa/Cocoa.h Metal/Metal.h CoreText/CoreText.h; do
+  echo "#import <$umbrella>" > "$work/tu.m"
+  for mode in sdk specialized; do
+    overlay=()
+    if [ "$mode" = specialized ]; then overlay=(-isystem "$work/availability"); fi
+    pp=(zig cc -target "$target" -E -x objective-c
+      -F "$root/Frameworks" ${overlay[@]+"${overlay[@]}"} -isystem "$root/include" "$work/tu.m")
+
+    # Sum the sizes and conditionals of the headers the umbrella reads.
+    "${pp[@]}" -H -o /dev/null 2> "$work/headers.txt"
+    sed -n 's/^\.* //p' "$work/headers.txt" | sort -u > "$work/files.txt"
+    bytes=$(xargs -r cat < "$work/files.txt" | wc -c)
+    ifs=$(xargs -r cat < "$work/files.txt" | grep -cE '^\s*#\s*(if|ifdef|ifndef|elif)\b' || true)
+
+    start=$(date +%s%N)
+    for _ in $(seq "$runs"); do "${pp[@]}" -o /dev/null; done
+    end=$(date +%s%N)
+    printf '%-20s %-12s %12s %8s %10s\n' "$umbrella" "$mode" "$bytes" "$ifs" "$(( (end - start) / runs / 1000000 ))"
+  done
+done
@@ -0,0 +1,85 @@
+#!/usr/bin/env bash
+# Compares build times of a Zig object that uses CoreText, CoreGraphics
+# and IOSurface through @cImport against one that uses the pre-translated
+# binding modules. "cold" starts from empty caches; "warm" then switches
+# the optimize mode, which makes @cImport translate again.
+#
+# Usage: bench/bindings.sh [target]
+set -euo pipefail
+
+target=${1:-aarch64-macos}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+cat > "$work/build.zig.zon" <<ZON
+.{
+    .name = "bench_bindings",
+    .version = "0.0.0",
+    .dependencies = .{
+        .macos_sdk = .{ .path = "$(realpath --relative-to="$work" "$root")" },
+    },
+    .paths = .{""},
+}
+ZON
+
+cat > "$work/build.zig" <<'ZIG'
+const std = @import("std");
+
+pub fn build(b: *std.Build) void {
+    const target = b.standardTargetOptions(.{});
+    const optimize = b.standardOptimizeOption(.{});
+    const mode = b.option(enum { cimport, module }, "mode", "") orelse .module;
+    const sdk = b.dependency("macos_sdk", .{ .target = target });
+
+    const obj = b.addObject(.{
+        .name = "bench",
+        .root_source_file = b.path(b.fmt("{s}.zig", .{@tagName(mode)})),
+        .target = target,
+        .optimize = optimize,
+    });
+    switch (mode) {
+        .cimport => {
+            obj.addSystemFrameworkPath(sdk.path("Frameworks"));
+            obj.addSystemIncludePath(sdk.path("include"));
+        },
+        .module => for ([_][]const u8{ "CoreText", "CoreGraphics", "IOSurface" }) |name| {
+            obj.root_module.addImport(name, sdk.module(name));
+        },
+    }
+    b.getInstallStep().dependOn(&obj.step);
+}
+ZIG
+
+cat > "$work/cimport.zig" <<'ZIG'
+const c = @cImport({
+    @cInclude("CoreText/CoreText.h");
+    @cInclude("CoreGraphics/CoreGraphics.h");
+    @cInclude("IOSurface/IOSurface.h");
+});
+
+export fn bench() usize {
+    return @sizeOf(c.CTFontRef) + @sizeOf(c.CGRect) + @sizeOf(c.IOSurfaceRef);
+}
+ZIG
+
+cat > "$work/module.zig" <<'ZIG'
+const ct = @import("CoreText");
+const cg = @import("CoreGraphics");
+const io = @import("IOSurface");
+
+export fn bench() usize {
+    return @sizeOf(ct.CTFontRef) + @sizeOf(cg.CGRect) + @sizeOf(io.IOSurfaceRef);
+}
+ZIG
+
+TIMEFORMAT=%R
+cd "$work"
+for mode in cimport module; do
+  rm -rf .zig-cache global-cache
+  for run in cold:Debug warm:ReleaseFast; do
+    seconds=$( { time zig build -Dtarget="$target" -Dmode="$mode" -Doptimize="${run#*:}" \
+      --global-cache-dir global-cache > /dev/null 2>&1; } 2>&1 )
+    printf '%-8s %-5s %ss\n' "$mode" "${run%%:*}" "$seconds"
+  done
+done
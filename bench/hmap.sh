@@ -0,0 +1,32 @@
+#!/usr/bin/env bash
+# Counts the file system syscalls clang makes to compile a Cocoa and a
+# Metal translation unit with the plain search paths and with the SDK
+# header map in front of them. Linux only (uses strace).
+#
+# Usage: bench/hmap.sh [target]
+set -euo pipefail
+
+target=${1:-aarch64-macos}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+cd "$root"
+zig build hmap
+
+syscalls=openat,open,stat,lstat,newfstatat,statx,access,readlink
+flags=(-target "$target" -fsyntax-only -x objective-c
+  -F "$root/Frameworks" -isystem "$root/include")
+
+for umbrella in Cocoa/Cocoa.h Metal/Metal.h; do
+  echo "#import <$umbrella>" > "$work/tu.m"
+  for mode in plain hmap; do
+    extra=()
+    if [ "$mode" = hmap ]; then extra=(-I "$root/zig-out/sdk.hmap"); fi
+
+    strace -f -c -e trace="$syscalls" -o "$work/strace.txt" \
+      zig cc "${extra[@]}" "${flags[@]}" "$work/tu.m"
+    total=$(awk '$NF == "total" { print $4 }' "$work/strace.txt")
+    printf '%-16s %-6s %s\n' "$umbrella" "$mode" "$total"
+  done
+done
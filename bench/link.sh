@@ -0,0 +1,78 @@
+#!/usr/bin/env bash
+# Times linking an AppKit + Metal app against the SDK's universal .tbd
+# stubs, against stubs slimmed to the target (see src/slim_tbd.zig) and
+# against stubs that also keep only the symbols the app references (see
+# src/minimal_tbd.zig). The object is compiled once and only the relink
+# is timed, as after an edit to one source of an incrementally built app.
+#
+# Usage: bench/link.sh [target] [runs]
+set -euo pipefail
+
+target=${1:-aarch64-macos}
+runs=${2:-20}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+case "$target" in
+  aarch64-*) tbd_target=arm64-macos ;;
+  x86_64-*) tbd_target=x86_64-macos ;;
+  *) echo "no slim stubs for $target" >&2; exit 1 ;;
+esac
+
+zig run -OReleaseSafe --dep dep_file -Mroot="$root/src/slim_tbd.zig" \
+  -OReleaseSafe -Mdep_file="$root/src/dep_file.zig" -- \
+  "$work/slim" "$work/slim.d" "$tbd_target" "$root" "$root/Frameworks" "$root/lib"
+
+cat > "$work/app.m" <<'OBJC'
+#import <AppKit/AppKit.h>
+#import <Metal/Metal.h>
+#import <QuartzCore/CAMetalLayer.h>
+
+int main(void) {
+    @autoreleasepool {
+        [NSApplication sharedApplication];
+        id<MTLDevice> device = MTLCreateSystemDefaultDevice();
+        NSWindow *window = [[NSWindow alloc] initWithContentRect:NSMakeRect(0, 0, 640, 480)
+                                                       styleMask:NSWindowStyleMaskTitled
+                                                         backing:NSBackingStoreBuffered
+                                                           defer:NO];
+        CAMetalLayer *layer = [CAMetalLayer layer];
+        layer.device = device;
+        window.contentView.layer = layer;
+        [window makeKeyAndOrderFront:nil];
+        [NSApp run];
+    }
+    return 0;
+}
+OBJC
+
+zig cc -target "$target" -c -F "$root/Frameworks" -isystem "$root/include" \
+  "$work/app.m" -o "$work/app.o"
+
+zig run -OReleaseSafe --dep object_symbols -Mroot="$root/src/referenced_symbols.zig" \
+  -OReleaseSafe -Mobject_symbols="$root/src/object_symbols.zig" -- \
+  "$work/app.symbols" "$work/app.o"
+zig run -OReleaseSafe --dep tbd --dep dep_file -Mroot="$root/src/minimal_tbd.zig" \
+  -OReleaseSafe -Mtbd="$root/src/tbd.zig" -OReleaseSafe -Mdep_file="$root/src/dep_file.zig" -- \
+  "$work/minimal" "$work/minimal.d" "$tbd_target" "$work/app.symbols" "$root" "$root/Frameworks" "$root/lib"
+
+printf '%-10s %10s %10s\n' stubs bytes ms/link
+for mode in universal slim minimal; do
+  case "$mode" in
+    universal) sdk=$root ;;
+    *) sdk=$work/$mode ;;
+  esac
+  link=(zig cc -target "$target" -F "$sdk/Frameworks" -L "$sdk/lib"
+    -framework AppKit -framework Metal -framework QuartzCore
+    "$work/app.o" -o "$work/app")
+
+  "${link[@]}" # warm up the zig cache
+  start=$(date +%s%N)
+  for _ in $(seq "$runs"); do "${link[@]}"; done
+  end=$(date +%s%N)
+
+  bytes=$(find -L "$sdk/Frameworks"/{AppKit,Foundation,CoreFoundation,Metal,QuartzCore,CoreGraphics,CoreImage}.framework \
+    -maxdepth 1 -name '*.tbd' -exec cat {} + | wc -c)
+  printf '%-10s %10s %10s\n' "$mode" "$bytes" "$(( (end - start) / runs / 1000000 ))"
+done
@@ -0,0 +1,161 @@
+#!/usr/bin/env bash
+# Compares the size of a Metal renderer written against objc-shims when
+# every send loads its selector at the call site (objc_msgSend) and when
+# the linker makes one objc_msgSend$<selector> stub per selector that
+# does (-Dobjc-msgsend-selector-stubs). Cross-compiles and links on any
+# host, against the SDK's .tbd stubs.
+#
+# Usage: bench/objc_stubs.sh [target]
+set -euo pipefail
+
+target=${1:-aarch64-macos}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+frameworks=(Foundation AppKit QuartzCore Metal)
+for name in "${frameworks[@]}"; do
+  printf '#import <%s/%s.h>\n' "$name" "$name"
+done > "$work/shims.m"
+zig cc -target "$target" -x objective-c -E -F "$root/Frameworks" -isystem "$root/include" \
+  "$work/shims.m" -o "$work/shims.i"
+zig run -OReleaseSafe "$root/src/objc_shims.zig" -- \
+  "$work/objc_shims.zig" "$work/shims.i" "${frameworks[@]}"
+
+cat > "$work/app.zig" <<'ZIG'
+const objc = @import("objc");
+const shims = @import("objc-shims");
+
+extern fn MTLCreateSystemDefaultDevice() ?objc.id;
+extern fn objc_autoreleasePoolPush() ?*anyopaque;
+extern fn objc_autoreleasePoolPop(pool: ?*anyopaque) void;
+
+const Renderer = struct {
+    queue: objc.id,
+    layer: objc.id,
+    scene: objc.id,
+    post: objc.id,
+    vertices: objc.id,
+    uniforms: objc.id,
+    indices: objc.id,
+
+    fn init(device: objc.id) ?Renderer {
+        const layer = shims.CALayer.layer(objc.class("CAMetalLayer")) orelse return null;
+        shims.CAMetalLayer.setDevice_(layer, device);
+        shims.CAMetalLayer.setPixelFormat_(layer, shims.MTLPixelFormatBGRA8Unorm);
+        shims.CAMetalLayer.setFramebufferOnly_(layer, true);
+        shims.CAMetalLayer.setDrawableSize_(layer, .{ .width = 1280, .height = 720 });
+        const library = shims.MTLDevice.newDefaultLibrary(device) orelse return null;
+        defer shims.NSObject.release(library);
+        return .{
+            .queue = shims.MTLDevice.newCommandQueue(device) orelse return null,
+            .layer = layer,
+            .scene = pipeline(device, library, "scene_vertex", "scene_fragment") orelse return null,
+            .post = pipeline(device, library, "post_vertex", "post_fragment") orelse return null,
+            .vertices = shims.MTLDevice.newBufferWithLength_options_(device, 1 << 20, shims.MTLResourceStorageModeShared) orelse return null,
+            .uniforms = shims.MTLDevice.newBufferWithLength_options_(device, 1 << 12, shims.MTLResourceStorageModeShared) orelse return null,
+            .indices = shims.MTLDevice.newBufferWithLength_options_(device, 1 << 18, shims.MTLResourceStorageModeShared) orelse return null,
+        };
+    }
+
+    fn pipeline(device: objc.id, library: objc.id, vertex: [*:0]const u8, fragment: [*:0]const u8) ?objc.id {
+        const descriptor = shims.NSObject.new(objc.class("MTLRenderPipelineDescriptor")) orelse return null;
+        defer shims.NSObject.release(descriptor);
+        const vertex_function = shims.MTLLibrary.newFunctionWithName_(library, string(vertex)) orelse return null;
+        defer shims.NSObject.release(vertex_function);
+        const fragment_function = shims.MTLLibrary.newFunctionWithName_(library, string(fragment)) orelse return null;
+        defer shims.NSObject.release(fragment_function);
+        shims.MTLRenderPipelineDescriptor.setVertexFunction_(descriptor, vertex_function);
+        shims.MTLRenderPipelineDescriptor.setFragmentFunction_(descriptor, fragment_function);
+        const attachments = shims.MTLRenderPipelineDescriptor.colorAttachments(descriptor) orelse return null;
+        const attachment = shims.MTLRenderPipelineColorAttachmentDescriptorArray.objectAtIndexedSubscript_(attachments, 0) orelse return null;
+        shims.MTLRenderPipelineColorAttachmentDescriptor.setPixelFormat_(attachment, shims.MTLPixelFormatBGRA8Unorm);
+        return shims.MTLDevice.newRenderPipelineStateWithDescriptor_error_(device, descriptor, null);
+    }
+
+    fn string(bytes: [*:0]const u8) ?objc.id {
+        return shims.NSString.stringWithUTF8String_(objc.class("NSString"), bytes);
+    }
+
+    fn frame(r: Renderer, time: f32) void {
+        const drawable = shims.CAMetalLayer.nextDrawable(r.layer) orelse return;
+        const texture = shims.CAMetalDrawable.texture(drawable) orelse return;
+        const commands = shims.MTLCommandQueue.commandBuffer(r.queue) orelse return;
+        const uniforms: *[4]f32 = @ptrCast(@alignCast(shims.MTLBuffer.contents(r.uniforms) orelse return));
+        uniforms.* = .{ time, @sin(time), @cos(time), 1 };
+
+        const scene = pass(texture, shims.MTLLoadActionClear) orelse return;
+        const encoder = shims.MTLCommandBuffer.renderCommandEncoderWithDescriptor_(commands, scene) orelse return;
+        shims.MTLRenderCommandEncoder.setRenderPipelineState_(encoder, r.scene);
+        shims.MTLRenderCommandEncoder.setViewport_(encoder, .{ .originX = 0, .originY = 0, .width = 1280, .height = 720, .znear = 0, .zfar = 1 });
+        shims.MTLRenderCommandEncoder.setVertexBuffer_offset_atIndex_(encoder, r.vertices, 0, 0);
+        shims.MTLRenderCommandEncoder.setVertexBuffer_offset_atIndex_(encoder, r.uniforms, 0, 1);
+        shims.MTLRenderCommandEncoder.setFragmentBuffer_offset_atIndex_(encoder, r.uniforms, 0, 0);
+        for (0..64) |i| {
+            shims.MTLRenderCommandEncoder.setScissorRect_(encoder, .{ .x = (i % 8) * 160, .y = (i / 8) * 90, .width = 160, .height = 90 });
+            shims.MTLRenderCommandEncoder.setVertexBytes_length_atIndex_(encoder, &i, @sizeOf(usize), 2);
+            shims.MTLRenderCommandEncoder.drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_(
+                encoder,
+                shims.MTLPrimitiveTypeTriangle,
+                6 * 1024,
+                shims.MTLIndexTypeUInt16,
+                r.indices,
+                i * 2 * 6 * 1024,
+            );
+        }
+        shims.MTLCommandEncoder.endEncoding(encoder);
+
+        const post = pass(texture, shims.MTLLoadActionLoad) orelse return;
+        const post_encoder = shims.MTLCommandBuffer.renderCommandEncoderWithDescriptor_(commands, post) orelse return;
+        shims.MTLRenderCommandEncoder.setRenderPipelineState_(post_encoder, r.post);
+        shims.MTLRenderCommandEncoder.setFragmentTexture_atIndex_(post_encoder, texture, 0);
+        shims.MTLRenderCommandEncoder.setFragmentBuffer_offset_atIndex_(post_encoder, r.uniforms, 0, 0);
+        shims.MTLRenderCommandEncoder.drawPrimitives_vertexStart_vertexCount_(post_encoder, shims.MTLPrimitiveTypeTriangle, 0, 3);
+        shims.MTLCommandEncoder.endEncoding(post_encoder);
+
+        shims.MTLCommandBuffer.presentDrawable_(commands, drawable);
+        shims.MTLCommandBuffer.commit(commands);
+    }
+
+    fn pass(texture: objc.id, load: shims.MTLLoadAction) ?objc.id {
+        const descriptor = shims.MTLRenderPassDescriptor.renderPassDescriptor(objc.class("MTLRenderPassDescriptor")) orelse return null;
+        const attachments = shims.MTLRenderPassDescriptor.colorAttachments(descriptor) orelse return null;
+        const attachment = shims.MTLRenderPassColorAttachmentDescriptorArray.objectAtIndexedSubscript_(attachments, 0) orelse return null;
+        shims.MTLRenderPassAttachmentDescriptor.setTexture_(attachment, texture);
+        shims.MTLRenderPassAttachmentDescriptor.setLoadAction_(attachment, load);
+        shims.MTLRenderPassAttachmentDescriptor.setStoreAction_(attachment, shims.MTLStoreActionStore);
+        shims.MTLRenderPassColorAttachmentDescriptor.setClearColor_(attachment, .{ .red = 0, .green = 0, .blue = 0, .alpha = 1 });
+        return descriptor;
+    }
+};
+
+pub fn main() void {
+    const device = MTLCreateSystemDefaultDevice() orelse return;
+    const renderer = Renderer.init(device) orelse return;
+    var time: f32 = 0;
+    while (time < 10) : (time += 1.0 / 60.0) {
+        const pool = objc_autoreleasePoolPush();
+        defer objc_autoreleasePoolPop(pool);
+        renderer.frame(time);
+    }
+}
+ZIG
+
+printf '%-10s %10s %10s %12s %14s %10s\n' sends __text __stubs __objc_stubs __objc_selrefs bytes
+for mode in msgsend stubs; do
+  echo "pub const msgsend_selector_stubs = $([ "$mode" = stubs ] && echo true || echo false);" \
+    > "$work/objc_options.zig"
+  zig build-exe -target "$target" -OReleaseFast \
+    --dep objc --dep objc-shims -Mroot="$work/app.zig" \
+    -OReleaseFast --dep objc_options -Mobjc="$root/src/objc.zig" \
+    -OReleaseFast -Mobjc_options="$work/objc_options.zig" \
+    -OReleaseFast --dep objc -Mobjc-shims="$work/objc_shims.zig" \
+    -F "$root/Frameworks" -L "$root/lib" \
+    -framework Foundation -framework QuartzCore -framework Metal \
+    --name "app-$mode" -femit-bin="$work/app-$mode"
+
+  read -r text stubs objc_stubs selrefs < <(zig run -OReleaseSafe "$root/src/section_sizes.zig" -- \
+    "$work/app-$mode" __text __stubs __objc_stubs __objc_selrefs)
+  printf '%-10s %10s %10s %12s %14s %10s\n' \
+    "$mode" "$text" "$stubs" "$objc_stubs" "$selrefs" "$(wc -c < "$work/app-$mode")"
+done
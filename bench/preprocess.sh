@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+# Times preprocessing the Cocoa, Metal and CoreText umbrellas against the
+# SDK and against the comment-stripped copy of its headers (see
+# src/strip_headers.zig), and prints how much text each one reads.
+#
+# Usage: bench/preprocess.sh [target] [runs]
+set -euo pipefail
+
+target=${1:-aarch64-macos}
+runs=${2:-10}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+zig run -OReleaseSafe --dep dep_file -Mroot="$root/src/strip_headers.zig" \
+  -OReleaseSafe -Mdep_file="$root/src/dep_file.zig" -- \
+  "$work/stripped" "$work/stripped.d" "$root/Frameworks" "$root/include"
+
+printf '%-20s %-9s %12s %10s\n' umbrella headers bytes ms/run
+for umbrella in Cocoa/Cocoa.h Metal/Metal.h CoreText/CoreText.h; do
+  echo "#import <$umbrella>" > "$work/tu.m"
+  for mode in sdk stripped; do
+    if [ "$mode" = sdk ]; then sdk=$root; else sdk=$work/stripped; fi
+    pp=(zig cc -target "$target" -E -x objective-c
+      -F "$sdk/Frameworks" -isystem "$sdk/include" "$work/tu.m")
+
+    # Sum the sizes of the headers the umbrella reads.
+    "${pp[@]}" -H -o /dev/null 2> "$work/headers.txt"
+    bytes=$(sed -n 's/^\.* //p' "$work/headers.txt" | sort -u | xargs -r cat | wc -c)
+
+    start=$(date +%s%N)
+    for _ in $(seq "$runs"); do "${pp[@]}" -o /dev/null; done
+    end=$(date +%s%N)
+    printf '%-20s %-9s %12s %10s\n' "$umbrella" "$mode" "$bytes" "$(( (end - start) / runs / 1000000 ))"
+  done
+done
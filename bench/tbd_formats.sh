@@ -0,0 +1,30 @@
+#!/usr/bin/env bash
+# Times parsing every .tbd stub of the SDK as shipped (TAPI v4 YAML) and
+# converted to TAPI v5 JSON (see src/tbd_v5.zig), after checking that
+# the conversion exports the same symbols. Both formats go through
+# tbd.parse; ld64 reads either. zig's own linker only reads v4.
+#
+# Usage: bench/tbd_formats.sh [runs]
+set -euo pipefail
+
+runs=${1:-20}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+tool() {
+  local name=$1
+  shift
+  zig run -OReleaseSafe --dep tbd --dep dep_file -Mroot="$root/src/$name.zig" \
+    -OReleaseSafe -Mtbd="$root/src/tbd.zig" -OReleaseSafe -Mdep_file="$root/src/dep_file.zig" -- "$@"
+}
+
+tool tbd_v5 "$work/v5" "$work/v5.d" "$root/Frameworks" "$root/lib"
+tool tbd_roundtrip "$root/Frameworks" "$work/v5/Frameworks"
+tool tbd_roundtrip "$root/lib" "$work/v5/lib"
+
+for format in v4 v5; do
+  if [ "$format" = v4 ]; then sdk=$root; else sdk=$work/v5; fi
+  printf '%s: ' "$format"
+  tool parse_stubs "$runs" "$sdk/Frameworks" "$sdk/lib"
+done
@@ -0,0 +1,84 @@
+#!/usr/bin/env bash
+# Times linking an app that uses Carbon, CoreServices, ApplicationServices
+# and AppKit symbols from their sub-frameworks (HIToolbox, CarbonCore,
+# LaunchServices, FSEvents, Metadata, HIServices, UIFoundation) against
+# the slimmed stubs as they are and with their umbrella stubs flattened
+# (see src/flatten_umbrellas.zig). Prints the size of the four umbrella
+# stubs and whether both links produce the same binary.
+#
+# Usage: bench/umbrella.sh [target] [runs]
+set -euo pipefail
+
+target=${1:-aarch64-macos}
+runs=${2:-20}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+case "$target" in
+  aarch64-*) tbd_target=arm64-macos ;;
+  x86_64-*) tbd_target=x86_64-macos ;;
+  *) echo "no stubs for $target" >&2; exit 1 ;;
+esac
+
+zig run -OReleaseSafe --dep dep_file -Mroot="$root/src/slim_tbd.zig" \
+  -OReleaseSafe -Mdep_file="$root/src/dep_file.zig" -- \
+  "$work/slim" "$work/slim.d" "$tbd_target" "$root" "$root/Frameworks" "$root/lib"
+zig run -OReleaseSafe --dep tbd --dep dep_file -Mroot="$root/src/flatten_umbrellas.zig" \
+  -OReleaseSafe -Mtbd="$root/src/tbd.zig" -OReleaseSafe -Mdep_file="$root/src/dep_file.zig" -- \
+  "$work/flat/Frameworks" "$work/flat.d" "$tbd_target" "$work/slim/Frameworks"
+
+cat > "$work/app.m" <<'OBJC'
+#import <AppKit/AppKit.h>
+#import <Carbon/Carbon.h>
+
+static void callback(ConstFSEventStreamRef stream, void *info, size_t count, void *paths,
+                     const FSEventStreamEventFlags flags[], const FSEventStreamEventId ids[]) {}
+
+int main(void) {
+    TISInputSourceRef source = TISCopyCurrentKeyboardLayoutInputSource();
+    CFDataRef layout = TISGetInputSourceProperty(source, kTISPropertyUnicodeKeyLayoutData);
+    UInt32 state = 0;
+    UniChar chars[4];
+    UniCharCount length = 0;
+    UCKeyTranslate((const UCKeyboardLayout *)CFDataGetBytePtr(layout), 0, kUCKeyActionDown, 0,
+                   LMGetKbdType(), kUCKeyTranslateNoDeadKeysBit, &state, 4, &length, chars);
+
+    EventHotKeyRef hotkey;
+    RegisterEventHotKey(0, 0, (EventHotKeyID){0}, GetApplicationEventTarget(), 0, &hotkey);
+
+    CFURLRef url = CFURLCreateWithString(NULL, CFSTR("https://example.com"), NULL);
+    CFURLRef app = LSCopyDefaultApplicationURLForURL(url, kLSRolesAll, NULL);
+    MDItemRef item = MDItemCreateWithURL(NULL, app);
+
+    CFArrayRef paths = CFArrayCreate(NULL, (const void **)&(CFStringRef){CFSTR("/tmp")}, 1, NULL);
+    FSEventStreamRef stream = FSEventStreamCreate(NULL, callback, NULL, paths,
+                                                  kFSEventStreamEventIdSinceNow, 1.0, 0);
+
+    NSFont *font = [NSFont systemFontOfSize:12];
+    NSLog(@"%d %p %p %@", AXIsProcessTrusted(), item, stream, font);
+    return 0;
+}
+OBJC
+
+zig cc -target "$target" -c -F "$root/Frameworks" -isystem "$root/include" \
+  "$work/app.m" -o "$work/app.o"
+
+printf '%-10s %10s %10s %10s\n' stubs bytes ms/link binary
+for mode in slim flat; do
+  link=(zig cc -target "$target" -F "$work/$mode/Frameworks" -L "$work/slim/lib"
+    -framework AppKit -framework Carbon -framework CoreServices -framework ApplicationServices
+    "$work/app.o" -o "$work/app-$mode")
+
+  "${link[@]}" # warm up the zig cache
+  start=$(date +%s%N)
+  for _ in $(seq "$runs"); do "${link[@]}"; done
+  end=$(date +%s%N)
+
+  bytes=$(cat "$work/$mode/Frameworks"/{AppKit,Carbon,CoreServices,ApplicationServices}.framework/*.tbd | wc -c)
+  same=-
+  if [ "$mode" = flat ]; then
+    if cmp -s "$work/app-slim" "$work/app-flat"; then same=same; else same=differs; fi
+  fi
+  printf '%-10s %10s %10s %10s\n' "$mode" "$bytes" "$(( (end - start) / runs / 1000000 ))" "$same"
+done
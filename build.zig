@@ -13,8 +13,759 @@ pub fn build(b: *std.Build) void {
     lib.linkLibC();
     addPaths(lib);
     b.installArtifact(lib);
+
+    const stubs_step = b.step("stubs", "Generate .tbd stubs for arm64-macos and x86_64-macos only");
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const stubs = slimStubs(b, b.resolveTargetQuery(.{ .cpu_arch = arch, .os_tag = .macos })).?;
+        stubs_step.dependOn(stubs.generated.file.step);
+    }
+
+    const verify_step = b.step("verify-stripped", "Check that the comment-stripped headers preprocess to the same tokens");
+    const verify_target = if (target.result.os.tag == .macos)
+        target
+    else
+        b.resolveTargetQuery(.{ .cpu_arch = .aarch64, .os_tag = .macos });
+    const verify_sources = b.addWriteFiles();
+    for (groups) |g| {
+        // Kernel.framework is for kernel extensions only.
+        if (!g.isFramework() or std.mem.eql(u8, g.name, "Kernel")) continue;
+        const source = verify_sources.add(
+            b.fmt("{s}.m", .{g.name}),
+            b.fmt("#import <{s}>\n", .{umbrellaHeader(b, g.name)}),
+        );
+        const compare = runTool(b, "same_tokens");
+        compare.addFileArg(preprocess(b, source, verify_target, .{}));
+        compare.addFileArg(preprocess(b, source, verify_target, .{ .strip_comments = true }));
+        // So that __FILE__ expands the same.
+        const sdk = Roots.sdk(b);
+        const stripped = Roots.init(b, .{ .strip_comments = true }, null);
+        compare.addDirectoryArg(sdk.include);
+        compare.addDirectoryArg(stripped.include);
+        compare.addDirectoryArg(sdk.frameworks);
+        compare.addDirectoryArg(stripped.frameworks);
+        verify_step.dependOn(&compare.step);
+    }
+
+    // For both architectures, at the minimum macOS of -Dtarget if it is
+    // macOS and zig's default otherwise.
+    const verify_availability_step = b.step(
+        "verify-availability",
+        "Check that the specialized availability headers preprocess to the same tokens",
+    );
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const arch_target = b.resolveTargetQuery(.{
+            .cpu_arch = arch,
+            .os_tag = .macos,
+            .os_version_min = if (target.result.os.tag == .macos) target.query.os_version_min else null,
+        });
+        for (groups) |g| {
+            if (!g.isFramework() or std.mem.eql(u8, g.name, "Kernel")) continue;
+            const source = verify_sources.getDirectory().path(b, b.fmt("{s}.m", .{g.name}));
+            const compare = runTool(b, "same_tokens");
+            compare.addFileArg(preprocess(b, source, arch_target, .{}));
+            compare.addFileArg(preprocess(b, source, arch_target, .{ .availability = true }));
+            verify_availability_step.dependOn(&compare.step);
+        }
+    }
+
+    // split.sh runs this before it publishes the groups.
+    const verify_groups_step = b.step("verify-groups", "Check that the groups cover every framework and what their headers include");
+    const check_groups = runTool(b, "check_groups");
+    check_groups.addDirectoryArg(.{ .cwd_relative = sdkPath("/.") });
+    check_groups.addArg(std.mem.join(b.allocator, ",", &core_deps) catch @panic("OOM"));
+    for (groups) |g| {
+        const deps = std.mem.join(b.allocator, ",", g.deps) catch @panic("OOM");
+        check_groups.addArg(b.fmt("{s}:{s}:{s}", .{ g.name, g.path, deps }));
+    }
+    verify_groups_step.dependOn(&check_groups.step);
+
+    addHeaderBenchmarks(b, b.step(
+        "bench-headers",
+        "Time -fsyntax-only of every umbrella for each architecture and language",
+    ));
+
+    addParseCost(b, b.step(
+        "parse-cost",
+        "Attribute the parse time of every umbrella to the headers it includes",
+    ));
+
+    const profile_step = b.step("profile", "Write the SDK profile of the sources given with -Dprofile-sources");
+    if (b.option([]const []const u8, "profile-sources", "Files or directories to compute an SDK profile for")) |paths| {
+        var sources = std.ArrayList(std.Build.LazyPath).init(b.allocator);
+        for (paths) |path| sources.append(.{ .cwd_relative = path }) catch @panic("OOM");
+        const profile = sdkProfile(b, .{ .sources = sources.items });
+        profile_step.dependOn(&b.addInstallFile(profile, "sdk.profile").step);
+    }
+
+    // Identical files are stored once. `materialize` rebuilds the tree
+    // from the store.
+    const dedup_step = b.step("dedup", "Store the SDK by content and report duplicate files");
+    const dedup = runTool(b, "dedup");
+    // The report covers every file in the tree, including ones a depfile
+    // of the files read last time would not list, so it always reruns.
+    dedup.has_side_effects = true;
+    const store = dedup.addOutputDirectoryArg("store");
+    dedup.addDirectoryArg(.{ .cwd_relative = sdkPath("/.") });
+    dedup.addArgs(&.{ "Frameworks", "include", "lib", "modules" });
+    dedup_step.dependOn(&b.addInstallDirectory(.{
+        .source_dir = store,
+        .install_dir = .prefix,
+        .install_subdir = "dedup",
+    }).step);
+
+    // The stub parser and symbol index, for build tools of dependents.
+    _ = b.addModule("tbd", .{ .root_source_file = b.path("src/tbd.zig") });
+    const test_step = b.step("test", "Run the unit tests of the parsers and tools in src/");
+    const tbd_tests = b.addTest(.{
+        .root_source_file = b.path("src/tbd.zig"),
+        .target = b.graph.host,
+    });
+    test_step.dependOn(&b.addRunArtifact(tbd_tests).step);
+    const objc_shims_tests = b.addTest(.{
+        .root_source_file = b.path("src/objc_shims.zig"),
+        .target = b.graph.host,
+    });
+    test_step.dependOn(&b.addRunArtifact(objc_shims_tests).step);
+    // The tools' own tests, with the module toolExe gives the tools
+    // that list their inputs.
+    for ([_][]const u8{
+        "src/check_groups.zig",
+        "src/scan_includes.zig",
+        "src/slim_tbd.zig",
+        "src/specialize_availability.zig",
+        "src/strip_headers.zig",
+    }) |path| {
+        const tool_tests = b.addTest(.{
+            .root_source_file = b.path(path),
+            .target = b.graph.host,
+        });
+        tool_tests.root_module.addImport("dep_file", b.createModule(.{
+            .root_source_file = b.path("src/dep_file.zig"),
+        }));
+        test_step.dependOn(&b.addRunArtifact(tool_tests).step);
+    }
+    const tbd_index_step = b.step("tbd-index", "Install the symbol index of every .tbd stub");
+    tbd_index_step.dependOn(&b.addInstallFile(tbdIndex(b), "sdk.tbdi").step);
+
+    const tbd_v5 = tbdV5(b);
+    const tbd_v5_step = b.step("tbd-v5", "Install the .tbd stubs converted to TAPI v5 JSON");
+    tbd_v5_step.dependOn(&b.addInstallDirectory(.{
+        .source_dir = tbd_v5,
+        .install_dir = .prefix,
+        .install_subdir = "tbd-v5",
+    }).step);
+    const verify_tbd_v5_step = b.step("verify-tbd-v5", "Check that the v5 stubs export the same symbols as the originals");
+    const sdk = Roots.sdk(b);
+    for ([_]std.Build.LazyPath{ sdk.frameworks, sdk.lib }, [_][]const u8{ "Frameworks", "lib" }) |original, dir| {
+        const check = runTool(b, "tbd_roundtrip");
+        check.addDirectoryArg(original);
+        check.addDirectoryArg(tbd_v5.path(b, dir));
+        verify_tbd_v5_step.dependOn(&check.step);
+    }
+
+    const link_list_step = b.step("link-list", "Write the frameworks that the objects given with -Dlink-objects need");
+    const stub_symbols_step = b.step("stub-symbols", "Write the symbols that the objects given with -Dlink-objects need");
+    if (b.option([]const []const u8, "link-objects", "Mach-O objects or static libraries to list the needed frameworks and symbols of")) |paths| {
+        var objects = std.ArrayList(std.Build.LazyPath).init(b.allocator);
+        for (paths) |path| objects.append(.{ .cwd_relative = path }) catch @panic("OOM");
+        const link_target = if (target.result.os.tag == .macos)
+            target
+        else
+            b.resolveTargetQuery(.{ .cpu_arch = .aarch64, .os_tag = .macos });
+        const list = neededLibraries(b, objects.items, link_target);
+        link_list_step.dependOn(&b.addInstallFile(list, "sdk.link").step);
+        const symbols = referencedSymbols(b, objects.items);
+        stub_symbols_step.dependOn(&b.addInstallFile(symbols, "sdk.symbols").step);
+    }
+
+    // Static selector and class references and constant strings for Zig
+    // code, checked against what clang emits for the same references and
+    // literals in Objective-C.
+    const objc_msgsend_selector_stubs = b.option(
+        bool,
+        "objc-msgsend-selector-stubs",
+        "Send messages through objc_msgSend$<selector> stubs the linker makes",
+    ) orelse false;
+    const objc = b.addModule("objc", .{ .root_source_file = b.path("src/objc.zig") });
+    objc.addOptions("objc_options", objcOptions(b, objc_msgsend_selector_stubs));
+    const verify_objc_step = b.step("verify-objc-refs", "Check that the objc module emits the sections and strings clang does");
+    const objc_sources = b.addWriteFiles();
+    const objc_zig = objc_sources.add("refs.zig",
+        \\const objc = @import("objc");
+        \\
+        \\export fn selectors(i: u32) objc.SEL {
+        \\    return switch (i) {
+        \\        0 => objc.sel("init"),
+        \\        1 => objc.sel("setDevice:"),
+        \\        else => objc.sel("class"),
+        \\    };
+        \\}
+        \\
+        \\export fn classes(i: u32) objc.Class {
+        \\    return if (i == 0) objc.class("NSWindow") else objc.class("CAMetalLayer");
+        \\}
+        \\
+        \\export fn strings(i: u32) *const anyopaque {
+        \\    return switch (i) {
+        \\        0 => objc.cfString("IOSurfaceWidth"),
+        \\        1 => objc.string("IOSurfaceWidth"),
+        \\        2 => objc.string("NSFontAttributeName"),
+        \\        else => objc.cfString("Größe"),
+        \\    };
+        \\}
+        \\
+    );
+    const objc_m = objc_sources.add("refs.m",
+        \\#import <AppKit/AppKit.h>
+        \\#import <QuartzCore/CAMetalLayer.h>
+        \\
+        \\SEL selectors(unsigned i) {
+        \\    switch (i) {
+        \\    case 0: return @selector(init);
+        \\    case 1: return @selector(setDevice:);
+        \\    default: return @selector(class);
+        \\    }
+        \\}
+        \\
+        \\Class classes(unsigned i) {
+        \\    return i == 0 ? [NSWindow class] : [CAMetalLayer class];
+        \\}
+        \\
+        \\const void *strings(unsigned i) {
+        \\    switch (i) {
+        \\    case 0: return CFSTR("IOSurfaceWidth");
+        \\    case 1: return @"IOSurfaceWidth";
+        \\    case 2: return @"NSFontAttributeName";
+        \\    default: return CFSTR("Größe");
+        \\    }
+        \\}
+        \\
+    );
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const arch_target = b.resolveTargetQuery(.{ .cpu_arch = arch, .os_tag = .macos });
+        const zig_obj = b.addObject(.{
+            .name = "refs",
+            .root_source_file = objc_zig,
+            .target = arch_target,
+            .optimize = .ReleaseFast,
+        });
+        zig_obj.root_module.addImport("objc", objc);
+        const clang = sdkClang(b, arch_target, .ReleaseFast, .objc, .{});
+        // Otherwise `[NSWindow class]` becomes a call to objc_opt_class
+        // and the "class" selector is not referenced.
+        clang.addArgs(&.{ "-fno-objc-convert-messages-to-runtime-calls", "-x", "objective-c", "-c" });
+        clang.addFileArg(objc_m);
+        clang.addArg("-o");
+        const clang_obj = clang.addOutputFileArg("refs.o");
+        const compare = runTool(b, "objc_sections");
+        compare.addFileArg(zig_obj.getEmittedBin());
+        compare.addFileArg(clang_obj);
+        verify_objc_step.dependOn(&compare.step);
+    }
+
+    // Typed message sends for the Objective-C frameworks, e.g.
+    // `shims.NSView.setNeedsDisplay_(view, true)`. Like the bindings below
+    // they are generated from the headers once per target.
+    const objc_imp_cache = b.option(bool, "objc-imp-cache", "Add IMP-caching variants to the objc-shims module") orelse false;
+    const shims_target = if (target.result.os.tag == .macos)
+        target
+    else
+        b.resolveTargetQuery(.{ .cpu_arch = .aarch64, .os_tag = .macos });
+    _ = b.addModule("objc-shims", .{
+        .root_source_file = objcShims(b, shims_target, objc_imp_cache),
+        .imports = &.{.{ .name = "objc", .module = objc }},
+    });
+    const objc_shims_step = b.step("objc-shims", "Generate the objc-shims module for each architecture");
+    const verify_shims_step = b.step("verify-objc-shims", "Check that objc-shims sends messages the way clang does");
+    const shims_sources = b.addWriteFiles();
+    const shims_zig = shims_sources.add("sends.zig",
+        \\const objc = @import("objc");
+        \\const shims = @import("objc-shims");
+        \\
+        \\export fn bounds(view: objc.id) shims.NSRect {
+        \\    return shims.NSView.bounds(view);
+        \\}
+        \\
+        \\export fn setBounds(view: objc.id, rect: shims.NSRect) void {
+        \\    shims.NSView.setBounds_(view, rect);
+        \\}
+        \\
+        \\export fn isOpaque(view: objc.id) bool {
+        \\    return shims.NSView.isOpaque(view);
+        \\}
+        \\
+        \\export fn newBuffer(device: objc.id, length: shims.NSUInteger) ?objc.id {
+        \\    return shims.MTLDevice.newBufferWithLength_options_(device, length, shims.MTLResourceStorageModeShared);
+        \\}
+        \\
+        \\export fn newLayer() ?objc.id {
+        \\    return shims.NSObject.alloc(objc.class("CAMetalLayer"));
+        \\}
+        \\
+        \\export fn contentsScale(layer: objc.id) f64 {
+        \\    return shims.CALayer.contentsScale(layer);
+        \\}
+        \\
+        \\var cache: objc.Cache = .{};
+        \\
+        \\export fn cachedContentsScale(layer: objc.id) f64 {
+        \\    return shims.CALayer.Cached.contentsScale(&cache, layer);
+        \\}
+        \\
+    );
+    const shims_m = shims_sources.add("sends.m",
+        \\#import <AppKit/AppKit.h>
+        \\#import <Metal/Metal.h>
+        \\#import <QuartzCore/CAMetalLayer.h>
+        \\
+        \\NSRect bounds(NSView *view) { return [view bounds]; }
+        \\void setBounds(NSView *view, NSRect rect) { [view setBounds:rect]; }
+        \\BOOL isOpaque(NSView *view) { return [view isOpaque]; }
+        \\
+        \\id<MTLBuffer> newBuffer(id<MTLDevice> device, NSUInteger length) {
+        \\    return [device newBufferWithLength:length options:MTLResourceStorageModeShared];
+        \\}
+        \\
+        \\CAMetalLayer *newLayer(void) { return [CAMetalLayer alloc]; }
+        \\CGFloat contentsScale(CALayer *layer) { return [layer contentsScale]; }
+        \\
+        \\CGFloat cachedContentsScale(CALayer *layer) {
+        \\    IMP imp = class_getMethodImplementation(object_getClass(layer), @selector(contentsScale));
+        \\    return ((CGFloat (*)(id, SEL))imp)(layer, @selector(contentsScale));
+        \\}
+        \\
+    );
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const arch_target = b.resolveTargetQuery(.{
+            .cpu_arch = arch,
+            .os_tag = .macos,
+            .os_version_min = if (target.result.os.tag == .macos) target.query.os_version_min else null,
+        });
+        const triple = arch_target.query.zigTriple(b.allocator) catch @panic("OOM");
+        const install = b.addInstallFile(
+            objcShims(b, arch_target, objc_imp_cache),
+            b.fmt("objc-shims/{s}.zig", .{triple}),
+        );
+        objc_shims_step.dependOn(&install.step);
+
+        // Checked both ways, whatever -Dobjc-msgsend-selector-stubs says.
+        const shims_source = objcShims(b, arch_target, true);
+        for ([_]bool{ false, true }) |selector_stubs| {
+            const objc_module = b.createModule(.{ .root_source_file = b.path("src/objc.zig") });
+            objc_module.addOptions("objc_options", objcOptions(b, selector_stubs));
+            const zig_obj = b.addObject(.{
+                .name = "sends",
+                .root_source_file = shims_zig,
+                .target = arch_target,
+                .optimize = .ReleaseFast,
+            });
+            zig_obj.root_module.addImport("objc", objc_module);
+            zig_obj.root_module.addImport("objc-shims", b.createModule(.{
+                .root_source_file = shims_source,
+                .imports = &.{.{ .name = "objc", .module = objc_module }},
+            }));
+            const clang = sdkClang(b, arch_target, .ReleaseFast, .objc, .{});
+            clang.addArgs(&.{ "-fno-objc-convert-messages-to-runtime-calls", "-x", "objective-c", "-c" });
+            if (selector_stubs) clang.addArg("-fobjc-msgsend-selector-stubs");
+            clang.addFileArg(shims_m);
+            clang.addArg("-o");
+            const clang_obj = clang.addOutputFileArg("sends.o");
+            const compare = runTool(b, "objc_sections");
+            compare.addFileArg(zig_obj.getEmittedBin());
+            compare.addFileArg(clang_obj);
+            verify_shims_step.dependOn(&compare.step);
+        }
+    }
+
+    // Block literals built at comptime. The module checks its layouts
+    // against the Blocks ABI when it compiles, so the check builds an
+    // object that uses every kind of block for each architecture. It then
+    // compares the descriptors and flags of the literals that the object
+    // hands to C with those clang emits for the same blocks.
+    const block = b.addModule("block", .{
+        .root_source_file = b.path("src/block.zig"),
+        .imports = &.{.{ .name = "objc", .module = objc }},
+    });
+    const objc_tests = b.addTest(.{
+        .root_source_file = b.path("src/objc.zig"),
+        .target = b.graph.host,
+    });
+    objc_tests.root_module.addOptions("objc_options", objcOptions(b, objc_msgsend_selector_stubs));
+    test_step.dependOn(&b.addRunArtifact(objc_tests).step);
+    const block_tests = b.addTest(.{
+        .root_source_file = b.path("src/block.zig"),
+        .target = b.graph.host,
+    });
+    block_tests.root_module.addImport("objc", objc);
+    test_step.dependOn(&b.addRunArtifact(block_tests).step);
+    const verify_blocks_step = b.step("verify-blocks", "Check the block literal layouts for each architecture against clang");
+    const blocks_sources = b.addWriteFiles();
+    const blocks_zig = blocks_sources.add("blocks.zig",
+        \\const objc = @import("objc");
+        \\const block = @import("block");
+        \\
+        \\const Rect = extern struct { x: f64, y: f64, width: f64, height: f64 };
+        \\
+        \\fn bounds(layer: objc.id) Rect {
+        \\    _ = layer;
+        \\    return .{ .x = 0, .y = 0, .width = 640, .height = 480 };
+        \\}
+        \\
+        \\const Frame = struct {
+        \\    layer: objc.id,
+        \\    presented: u32 = 0,
+        \\
+        \\    fn completed(frame: *Frame, buffer: objc.id) void {
+        \\        _ = buffer;
+        \\        frame.presented += 1;
+        \\    }
+        \\};
+        \\
+        \\const Counter = struct {
+        \\    total: u64 = 0,
+        \\
+        \\    fn add(counter: *Counter, n: u64, stop: *bool) void {
+        \\        counter.total += n;
+        \\        stop.* = counter.total > 100;
+        \\    }
+        \\};
+        \\
+        \\export fn boundsBlock() *const anyopaque {
+        \\    return block.global(bounds);
+        \\}
+        \\
+        \\export fn present(layer: objc.id, buffer: objc.id) u32 {
+        \\    var done = block.Stack(Frame, Frame.completed).init(.{ .layer = layer });
+        \\    block.call(void, &done, .{buffer});
+        \\    const kept = block.copy(&done);
+        \\    defer block.release(kept);
+        \\    block.call(void, kept, .{buffer});
+        \\    return kept.contextPtr().presented;
+        \\}
+        \\
+        \\export fn sum(n: u64) u64 {
+        \\    var add = block.Stack(Counter, Counter.add).init(.{});
+        \\    var stop = false;
+        \\    block.call(void, &add, .{ n, &stop });
+        \\    return add.contextPtr().total;
+        \\}
+        \\
+    );
+    // What clang can capture the same way. A `__block` variable has a
+    // byref layout that `block.Stack` does not make, so the counter
+    // captures a pointer to its total instead.
+    const literals_zig = blocks_sources.add("literals.zig",
+        \\const objc = @import("objc");
+        \\const block = @import("block");
+        \\
+        \\const Rect = extern struct { x: f64, y: f64, width: f64, height: f64 };
+        \\
+        \\extern fn keep(literal: *const anyopaque) void;
+        \\extern fn record(layer: objc.id, buffer: objc.id, presented: u32) void;
+        \\
+        \\fn nothing() void {}
+        \\
+        \\fn bounds(layer: objc.id) Rect {
+        \\    _ = layer;
+        \\    return .{ .x = 0, .y = 0, .width = 640, .height = 480 };
+        \\}
+        \\
+        \\const Frame = extern struct {
+        \\    layer: objc.id,
+        \\    presented: u32,
+        \\
+        \\    fn completed(frame: *Frame, buffer: objc.id) void {
+        \\        record(frame.layer, buffer, frame.presented);
+        \\    }
+        \\};
+        \\
+        \\const Counter = extern struct {
+        \\    total: *u64,
+        \\
+        \\    fn add(counter: *Counter, n: u64, stop: *bool) void {
+        \\        counter.total.* += n;
+        \\        stop.* = counter.total.* > 100;
+        \\    }
+        \\};
+        \\
+        \\export fn globals() void {
+        \\    keep(block.global(nothing));
+        \\    keep(block.global(bounds));
+        \\}
+        \\
+        \\export fn present(layer: objc.id) void {
+        \\    var done = block.Stack(Frame, Frame.completed).init(.{ .layer = layer, .presented = 0 });
+        \\    keep(&done);
+        \\}
+        \\
+        \\export fn sum(total: *u64) void {
+        \\    var add = block.Stack(Counter, Counter.add).init(.{ .total = total });
+        \\    keep(&add);
+        \\}
+        \\
+    );
+    const literals_m = blocks_sources.add("literals.m",
+        \\#include <stdbool.h>
+        \\#include <stdint.h>
+        \\
+        \\typedef struct { double x, y, width, height; } Rect;
+        \\
+        \\void keep(id literal);
+        \\void record(id layer, id buffer, unsigned presented);
+        \\
+        \\void globals(void) {
+        \\    keep(^{});
+        \\    keep(^Rect(id layer) { return (Rect){0, 0, 640, 480}; });
+        \\}
+        \\
+        \\void present(id layer) {
+        \\    unsigned presented = 0;
+        \\    keep(^(id buffer) { record(layer, buffer, presented); });
+        \\}
+        \\
+        \\void sum(uint64_t *total) {
+        \\    keep(^(uint64_t n, bool *stop) {
+        \\        *total += n;
+        \\        *stop = *total > 100;
+        \\    });
+        \\}
+        \\
+    );
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const arch_target = b.resolveTargetQuery(.{ .cpu_arch = arch, .os_tag = .macos });
+        const blocks_obj = b.addObject(.{
+            .name = "blocks",
+            .root_source_file = blocks_zig,
+            .target = arch_target,
+            .optimize = .ReleaseFast,
+        });
+        blocks_obj.root_module.addImport("objc", objc);
+        blocks_obj.root_module.addImport("block", block);
+        verify_blocks_step.dependOn(&blocks_obj.step);
+
+        const zig_obj = b.addObject(.{
+            .name = "literals",
+            .root_source_file = literals_zig,
+            .target = arch_target,
+            .optimize = .ReleaseFast,
+        });
+        zig_obj.root_module.addImport("objc", objc);
+        zig_obj.root_module.addImport("block", block);
+        const clang = sdkClang(b, arch_target, .ReleaseFast, .objc, .{});
+        clang.addArgs(&.{ "-x", "objective-c", "-c" });
+        clang.addFileArg(literals_m);
+        clang.addArg("-o");
+        const clang_obj = clang.addOutputFileArg("literals.o");
+        const compare = runTool(b, "objc_sections");
+        compare.addArg("--blocks");
+        compare.addFileArg(zig_obj.getEmittedBin());
+        compare.addFileArg(clang_obj);
+        verify_blocks_step.dependOn(&compare.step);
+    }
+
+    const hmap_step = b.step("hmap", "Install a header map of the whole SDK");
+    hmap_step.dependOn(&b.addInstallFile(headerMap(b, null), "sdk.hmap").step);
+
+    // Pre-translated bindings, e.g. `sdk.module("CoreText")`. Unlike
+    // @cImport they are translated once per target (architecture and
+    // minimum macOS version) rather than per optimize mode and consumer
+    // defines, and the zig cache keys them on every SDK header they read.
+    const umbrellas = b.addWriteFiles();
+    var sources: [bindings.len]std.Build.LazyPath = undefined;
+    for (bindings, &sources) |binding, *source| {
+        source.* = umbrellas.add(b.fmt("{s}.h", .{binding.name}), b.fmt("#include <{s}>\n", .{binding.header}));
+        _ = translateFramework(b, source.*, target).addModule(binding.name);
+    }
+
+    const bindings_step = b.step("bindings", "Translate the C frameworks to Zig for each architecture");
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const arch_target = b.resolveTargetQuery(.{
+            .cpu_arch = arch,
+            .os_tag = .macos,
+            .os_version_min = if (target.result.os.tag == .macos) target.query.os_version_min else null,
+        });
+        const triple = arch_target.query.zigTriple(b.allocator) catch @panic("OOM");
+        for (bindings, sources) |binding, source| {
+            const install = b.addInstallFile(
+                translateFramework(b, source, arch_target).getOutput(),
+                b.fmt("bindings/{s}/{s}.zig", .{ triple, binding.name }),
+            );
+            bindings_step.dependOn(&install.step);
+        }
+    }
+}
+
+/// Frameworks whose headers are usable from C and so can be translated to
+/// Zig. The Objective-C frameworks (Foundation, AppKit, Metal...) cannot.
+pub const bindings = [_]struct { name: []const u8, header: []const u8 }{
+    .{ .name = "ApplicationServices", .header = "ApplicationServices/ApplicationServices.h" },
+    .{ .name = "AudioToolbox", .header = "AudioToolbox/AudioToolbox.h" },
+    .{ .name = "AudioUnit", .header = "AudioUnit/AudioUnit.h" },
+    .{ .name = "CFNetwork", .header = "CFNetwork/CFNetwork.h" },
+    .{ .name = "Carbon", .header = "Carbon/Carbon.h" },
+    .{ .name = "ColorSync", .header = "ColorSync/ColorSync.h" },
+    .{ .name = "CoreAudio", .header = "CoreAudio/CoreAudio.h" },
+    .{ .name = "CoreAudioTypes", .header = "CoreAudioTypes/CoreAudioTypes.h" },
+    .{ .name = "CoreFoundation", .header = "CoreFoundation/CoreFoundation.h" },
+    .{ .name = "CoreGraphics", .header = "CoreGraphics/CoreGraphics.h" },
+    .{ .name = "CoreServices", .header = "CoreServices/CoreServices.h" },
+    .{ .name = "CoreText", .header = "CoreText/CoreText.h" },
+    .{ .name = "CoreVideo", .header = "CoreVideo/CoreVideo.h" },
+    .{ .name = "DiskArbitration", .header = "DiskArbitration/DiskArbitration.h" },
+    .{ .name = "IOKit", .header = "IOKit/IOKitLib.h" },
+    .{ .name = "IOSurface", .header = "IOSurface/IOSurface.h" },
+    .{ .name = "ImageIO", .header = "ImageIO/ImageIO.h" },
+    .{ .name = "OpenGL", .header = "OpenGL/OpenGL.h" },
+    .{ .name = "QuartzCore", .header = "QuartzCore/QuartzCore.h" },
+    .{ .name = "Security", .header = "Security/Security.h" },
+};
+
+fn translateFramework(
+    b: *std.Build,
+    source: std.Build.LazyPath,
+    target: std.Build.ResolvedTarget,
+) *std.Build.Step.TranslateC {
+    const translate = b.addTranslateC(.{
+        .root_source_file = source,
+        .target = target,
+        // Fixed so that switching optimize modes never re-translates.
+        .optimize = .Debug,
+    });
+    translate.addSystemFrameworkPath(b.path("Frameworks"));
+    translate.addSystemIncludePath(b.path("include"));
+    return translate;
+}
+
+/// libc++ headers parsed by `bench-headers` in the C++ modes.
+const libcxx_headers = [_][]const u8{
+    "algorithm", "array",    "atomic",        "chrono",  "functional",
+    "iostream",  "map",      "memory",        "mutex",   "optional",
+    "string",    "thread",   "unordered_map", "variant", "vector",
+};
+
+/// Adds a run for every umbrella in each language it can be parsed in, for
+/// aarch64-macos and x86_64-macos. Each run records its wall time, peak
+/// RSS and -ftime-trace; the results go to `bench-headers/` in the install
+/// prefix, with a summary in `report.json`. The runs are never cached and
+/// run in parallel like other steps (pass `-j1` for quieter numbers).
+fn addHeaderBenchmarks(b: *std.Build, step: *std.Build.Step) void {
+    const Tu = struct { name: []const u8, source: std.Build.LazyPath, c: bool, cxx_only: bool };
+    var tus = std.ArrayList(Tu).init(b.allocator);
+    const sources = b.addWriteFiles();
+    for (groups) |g| {
+        if (!g.isFramework() or std.mem.eql(u8, g.name, "Kernel")) continue;
+        const c = for (bindings) |binding| {
+            if (std.mem.eql(u8, binding.name, g.name)) break true;
+        } else false;
+        tus.append(.{
+            .name = g.name,
+            .source = sources.add(g.name, b.fmt("#include <{s}>\n", .{umbrellaHeader(b, g.name)})),
+            .c = c,
+            .cxx_only = false,
+        }) catch @panic("OOM");
+    }
+    var libcxx = std.ArrayList(u8).init(b.allocator);
+    for (libcxx_headers) |header| libcxx.writer().print("#include <{s}>\n", .{header}) catch @panic("OOM");
+    tus.append(.{ .name = "libc++", .source = sources.add("libc++", libcxx.items), .c = true, .cxx_only = true }) catch @panic("OOM");
+
+    const report = runTool(b, "bench_report");
+    report.has_side_effects = true;
+    const json = report.addOutputFileArg("report.json");
+
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const target = b.resolveTargetQuery(.{ .cpu_arch = arch, .os_tag = .macos });
+        for ([_]Lang{ .c, .objc, .cxx, .objcxx }) |lang| {
+            const objc = lang == .objc or lang == .objcxx;
+            const cxx = lang == .cxx or lang == .objcxx;
+            for (tus.items) |tu| {
+                if (!objc and !tu.c) continue;
+                if (!cxx and tu.cxx_only) continue;
+
+                const label = b.fmt("{s}-macos/{s}/{s}", .{ @tagName(arch), @tagName(lang), tu.name });
+                const run = runTool(b, "bench_tu");
+                run.has_side_effects = true;
+                report.addFileArg(run.addOutputFileArg("record.json"));
+                const trace = run.addOutputFileArg("trace.json");
+                _ = run.addOutputFileArg("stderr.txt");
+                run.addArgs(&.{ label, b.graph.zig_exe, "clang" });
+                addSdkClangArgs(run, target, .Debug, lang, .{});
+                run.addArgs(&.{ "-x", lang.source(), "-fsyntax-only" });
+                run.addFileArg(tu.source);
+                step.dependOn(&b.addInstallFile(trace, b.fmt("bench-headers/{s}.json", .{label})).step);
+            }
+        }
+    }
+    step.dependOn(&b.addInstallFile(json, "bench-headers/report.json").step);
 }
 
+/// Parses each framework umbrella once per architecture with `-H` and a
+/// full-resolution `-ftime-trace`, then ranks the headers by what they
+/// cost across all umbrellas.
+fn addParseCost(b: *std.Build, step: *std.Build.Step) void {
+    const sources = b.addWriteFiles();
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const target = b.resolveTargetQuery(.{ .cpu_arch = arch, .os_tag = .macos });
+        const report = runTool(b, "parse_cost");
+        report.has_side_effects = true;
+        const json = report.addOutputFileArg("parse-cost.json");
+        const folded = report.addOutputFileArg("parse-cost.folded");
+        const sdk = Roots.sdk(b);
+        report.addDirectoryArg(sdk.frameworks);
+        report.addDirectoryArg(sdk.include);
+
+        for (groups) |g| {
+            if (!g.isFramework() or std.mem.eql(u8, g.name, "Kernel")) continue;
+            const source = sources.add(
+                b.fmt("{s}.m", .{g.name}),
+                b.fmt("#import <{s}>\n", .{umbrellaHeader(b, g.name)}),
+            );
+            const run = runTool(b, "bench_tu");
+            run.has_side_effects = true;
+            _ = run.addOutputFileArg("record.json");
+            const trace = run.addOutputFileArg("trace.json");
+            const includes = run.addOutputFileArg("stderr.txt");
+            run.addArgs(&.{ g.name, b.graph.zig_exe, "clang" });
+            addSdkClangArgs(run, target, .Debug, .objc, .{});
+            run.addArgs(&.{ "-x", "objective-c", "-fsyntax-only", "-H", "-ftime-trace-granularity=0" });
+            run.addFileArg(source);
+
+            report.addArg(g.name);
+            report.addFileArg(trace);
+            report.addFileArg(includes);
+        }
+
+        const dir = b.fmt("parse-cost/{s}-macos", .{@tagName(arch)});
+        step.dependOn(&b.addInstallFile(json, b.fmt("{s}.json", .{dir})).step);
+        step.dependOn(&b.addInstallFile(folded, b.fmt("{s}.folded", .{dir})).step);
+    }
+}
+
+/// The header that includes all of a framework's headers.
+fn umbrellaHeader(b: *std.Build, name: []const u8) []const u8 {
+    for (bindings) |binding| {
+        if (std.mem.eql(u8, binding.name, name)) return binding.header;
+    }
+    return b.fmt("{s}/{s}.h", .{ name, name });
+}
+
+/// Preprocesses an Objective-C source against the SDK, without line
+/// markers.
+fn preprocess(
+    b: *std.Build,
+    source: std.Build.LazyPath,
+    target: std.Build.ResolvedTarget,
+    paths: PathsOptions,
+) std.Build.LazyPath {
+    const run = sdkClang(b, target, .Debug, .objc, paths);
+    addDepFile(run);
+    run.addArgs(&.{ "-x", "objective-c", "-E", "-P" });
+    run.addFileArg(source);
+    run.addArg("-o");
+    return run.addOutputFileArg("out.i");
+}
+
+/// Adds the whole SDK, all of which is in this package. To fetch only
+/// part of it, see `addGroups`.
 pub fn addPaths(step: *std.Build.Step.Compile) void {
     step.addSystemFrameworkPath(.{ .cwd_relative = sdkPath("/Frameworks") });
     step.addSystemIncludePath(.{ .cwd_relative = sdkPath("/include") });
@@ -27,6 +778,985 @@ pub fn addPathsModule(m: *std.Build.Module) void {
     m.addLibraryPath(.{ .cwd_relative = sdkPath("/lib") });
 }
 
+pub const PathsOptions = struct {
+    /// Frameworks that may be included or linked, e.g. `&.{"Metal"}`.
+    /// The frameworks their headers include are allowed too. Null allows
+    /// every framework in the SDK.
+    frameworks: ?[]const []const u8 = null,
+
+    /// Put a header map of the allowed frameworks and `include/` in front
+    /// of the search path so most SDK includes resolve in one lookup.
+    header_map: bool = false,
+
+    /// Link against copies of the `.tbd` stubs that list only the
+    /// module's target (arm64-macos or x86_64-macos). The SDK's stubs
+    /// also describe x86_64h, arm64e and Mac Catalyst, all of which the
+    /// linker would parse. Has no effect if the module has no target.
+    slim_stubs: bool = true,
+
+    /// Use a generated view of the SDK without symlinks or framework
+    /// bundles: headers as `include/<Framework>/...` on a plain include
+    /// path and stubs under `lib/`. Files are hard links into the SDK, so
+    /// the view also works where symlinks are lost (some file systems,
+    /// caches and archives).
+    flat: bool = false,
+
+    /// Read headers from a copy with comments and redundant whitespace
+    /// removed, generated in the zig cache. The preprocessor sees the
+    /// same tokens (`zig build verify-stripped` checks every umbrella),
+    /// on the same lines, but lexes well under half the text.
+    strip_comments: bool = false,
+
+    /// An SDK profile written by `sdkProfile`. Only the headers it lists
+    /// are visible, so an include the profile did not anticipate fails
+    /// instead of pulling in more of the SDK.
+    profile: ?std.Build.LazyPath = null,
+
+    /// Put copies of the availability headers (`Availability.h`,
+    /// `AvailabilityMacros.h`...) specialized for the module's target in
+    /// front of `include/`. Every conditional that only depends on the
+    /// architecture, the minimum macOS version or the compiler is
+    /// resolved, which removes most of what every TU preprocesses before
+    /// its first declaration (`zig build verify-availability` checks that
+    /// every umbrella preprocesses the same). Assumes the consumer does
+    /// not define `MAC_OS_X_VERSION_MIN_REQUIRED` itself. Has no effect if
+    /// the module has no target.
+    availability: bool = false,
+
+    /// A symbol list written by `referencedSymbols`. Link against copies
+    /// of the stubs that list only the module's target and these symbols,
+    /// so that relinking parses a few KB of stubs rather than megabytes.
+    /// A symbol the list does not have is undefined until the list is
+    /// regenerated. Takes precedence over `slim_stubs`. Has no effect if
+    /// the module has no target.
+    stub_symbols: ?std.Build.LazyPath = null,
+
+    /// Link against stubs in which umbrella frameworks (CoreServices,
+    /// ApplicationServices, Carbon, AppKit...) export the symbols of the
+    /// private sub-frameworks they re-export as their own, so the linker
+    /// does not follow a re-export chain for each of them. The linked
+    /// binary is the same. Has no effect if the module has no target.
+    flat_umbrellas: bool = false,
+};
+
+pub fn addPathsWithOptions(step: *std.Build.Step.Compile, options: PathsOptions) void {
+    addPathsModuleWithOptions(step.root_module, options);
+}
+
+pub fn addPathsModuleWithOptions(m: *std.Build.Module, options: PathsOptions) void {
+    const b = m.owner;
+    const roots = Roots.init(b, options, m.resolved_target);
+    if (options.header_map) m.addIncludePath(headerMapOf(b, roots, options.frameworks));
+    if (options.availability and m.resolved_target != null) {
+        if (availabilityHeaders(b, m.resolved_target.?, roots.include)) |dir| m.addSystemIncludePath(dir);
+    }
+    if (options.flat) {
+        const view = flatViewOf(b, roots, options.frameworks);
+        m.addSystemIncludePath(view.path(b, "include"));
+        // Only for `-framework`: every header is found on the include
+        // path first.
+        m.addSystemFrameworkPath(view.path(b, "lib"));
+        m.addLibraryPath(view.path(b, "lib"));
+        return;
+    }
+
+    if (options.frameworks) |names| {
+        m.addSystemFrameworkPath(searchRootIn(b, roots.frameworks, names));
+    } else {
+        m.addSystemFrameworkPath(roots.frameworks);
+    }
+    m.addSystemIncludePath(roots.include);
+    m.addLibraryPath(roots.lib);
+}
+
+/// The directories that a `PathsOptions` takes headers and stubs from:
+/// the SDK itself or copies of it generated in the zig cache.
+const Roots = struct {
+    include: std.Build.LazyPath,
+    /// Framework headers and stubs.
+    frameworks: std.Build.LazyPath,
+    lib: std.Build.LazyPath,
+
+    /// Stubs are only slimmed for a known target, as only linking needs
+    /// them.
+    fn init(b: *std.Build, options: PathsOptions, target: ?std.Build.ResolvedTarget) Roots {
+        const sdk_dir: std.Build.LazyPath = .{ .cwd_relative = sdkPath("/.") };
+        const base = if (options.strip_comments) strippedHeaders(b) else sdk_dir;
+        const headers = if (options.profile) |profile| profileView(b, profile, base) else base;
+        const stubs = if (target == null)
+            null
+        else if (options.stub_symbols) |symbols|
+            minimalStubsOf(b, target.?, symbols, headers)
+        else if (options.slim_stubs)
+            slimStubsOf(b, target.?, headers)
+        else
+            null;
+        const frameworks = (stubs orelse headers).path(b, "Frameworks");
+        return .{
+            .include = headers.path(b, "include"),
+            .frameworks = if (options.flat_umbrellas and target != null)
+                flatUmbrellasOf(b, target.?, frameworks) orelse frameworks
+            else
+                frameworks,
+            .lib = (stubs orelse sdk_dir).path(b, "lib"),
+        };
+    }
+
+    fn sdk(b: *std.Build) Roots {
+        return init(b, .{}, null);
+    }
+};
+
+/// Returns a directory with the headers of the given frameworks (or of
+/// every framework if `frameworks` is null) and of `include/` under
+/// `include/`, and their `.tbd` stubs under `lib/`, as hard links into the
+/// SDK. See `PathsOptions.flat`.
+pub fn flatView(b: *std.Build, frameworks: ?[]const []const u8) std.Build.LazyPath {
+    return flatViewOf(b, Roots.sdk(b), frameworks);
+}
+
+fn flatViewOf(b: *std.Build, roots: Roots, frameworks: ?[]const []const u8) std.Build.LazyPath {
+    const run = runTool(b, "flat_view");
+    const view = run.addOutputDirectoryArg("sdk");
+    run.addDirectoryArg(roots.include);
+    run.addDirectoryArg(roots.frameworks);
+    run.addDirectoryArg(roots.lib);
+    if (frameworks) |names| {
+        for (groupClosure(b.allocator, names)) |g| {
+            if (g.isFramework()) run.addArg(g.name);
+        }
+    }
+    return view;
+}
+
+/// Returns a copy of the SDK's `Frameworks/` and `lib/` whose `.tbd` stubs
+/// list only `target`, or null if there are no stubs for it. Headers are
+/// linked from the SDK, so the copy of `Frameworks/` is a complete
+/// framework search path.
+pub fn slimStubs(b: *std.Build, target: std.Build.ResolvedTarget) ?std.Build.LazyPath {
+    return slimStubsOf(b, target, .{ .cwd_relative = sdkPath("/.") });
+}
+
+/// `headers` is the SDK or a copy of it to link the headers from.
+fn slimStubsOf(b: *std.Build, target: std.Build.ResolvedTarget, headers: std.Build.LazyPath) ?std.Build.LazyPath {
+    const t = target.result;
+    if (t.os.tag != .macos) return null;
+    const arch = switch (t.cpu.arch) {
+        .aarch64 => "arm64",
+        .x86_64 => "x86_64",
+        else => return null,
+    };
+
+    const run = runTool(b, "slim_tbd");
+    const dir = run.addOutputDirectoryArg("stubs");
+    addInputsDepFile(run);
+    run.addArg(b.fmt("{s}-macos", .{arch}));
+    run.addDirectoryArg(headers);
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/Frameworks") });
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/lib") });
+    return dir;
+}
+
+/// Returns a copy of the SDK's `Frameworks/` and `lib/` whose `.tbd` stubs
+/// list only `target` and the symbols in `symbols`, a file written by
+/// `referencedSymbols`. Null if there are no stubs for the target. See
+/// `PathsOptions.stub_symbols`.
+pub fn minimalStubs(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    symbols: std.Build.LazyPath,
+) ?std.Build.LazyPath {
+    return minimalStubsOf(b, target, symbols, .{ .cwd_relative = sdkPath("/.") });
+}
+
+fn minimalStubsOf(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    symbols: std.Build.LazyPath,
+    headers: std.Build.LazyPath,
+) ?std.Build.LazyPath {
+    const t = target.result;
+    if (t.os.tag != .macos) return null;
+    const arch = switch (t.cpu.arch) {
+        .aarch64 => "arm64",
+        .x86_64 => "x86_64",
+        else => return null,
+    };
+
+    const run = runTool(b, "minimal_tbd");
+    const dir = run.addOutputDirectoryArg("stubs");
+    addInputsDepFile(run);
+    run.addArg(b.fmt("{s}-macos", .{arch}));
+    run.addFileArg(symbols);
+    run.addDirectoryArg(headers);
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/Frameworks") });
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/lib") });
+    return dir;
+}
+
+/// Returns a copy of the SDK's `Frameworks/` whose umbrella framework
+/// stubs are flattened for `target`, or null if there are no stubs for
+/// it. See `PathsOptions.flat_umbrellas`.
+pub fn flatUmbrellas(b: *std.Build, target: std.Build.ResolvedTarget) ?std.Build.LazyPath {
+    return flatUmbrellasOf(b, target, .{ .cwd_relative = sdkPath("/Frameworks") });
+}
+
+/// `frameworks` is the SDK's `Frameworks/` or a copy of it with slimmed
+/// or minimal stubs.
+fn flatUmbrellasOf(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    frameworks: std.Build.LazyPath,
+) ?std.Build.LazyPath {
+    const t = target.result;
+    if (t.os.tag != .macos) return null;
+    const arch = switch (t.cpu.arch) {
+        .aarch64 => "arm64",
+        .x86_64 => "x86_64",
+        else => return null,
+    };
+
+    const run = runTool(b, "flatten_umbrellas");
+    const dir = run.addOutputDirectoryArg("Frameworks");
+    addInputsDepFile(run);
+    run.addArg(b.fmt("{s}-macos", .{arch}));
+    run.addDirectoryArg(frameworks);
+    return dir;
+}
+
+/// Returns a copy of the SDK's `Frameworks/` and `include/` with comments
+/// and redundant whitespace removed from the headers. It is generated in
+/// the zig cache and never distributed. See `PathsOptions.strip_comments`.
+pub fn strippedHeaders(b: *std.Build) std.Build.LazyPath {
+    const run = runTool(b, "strip_headers");
+    const dir = run.addOutputDirectoryArg("sdk");
+    addInputsDepFile(run);
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/Frameworks") });
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/include") });
+    return dir;
+}
+
+/// Returns copies of the availability headers under `include` with what
+/// `target` fixes resolved, or null if there is nothing to specialize for
+/// it. Directives and removed text become empty lines, so line numbers do
+/// not change. See `PathsOptions.availability`.
+pub fn availabilityHeaders(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    include: std.Build.LazyPath,
+) ?std.Build.LazyPath {
+    const t = target.result;
+    if (t.os.tag != .macos) return null;
+    switch (t.cpu.arch) {
+        .aarch64, .x86_64 => {},
+        else => return null,
+    }
+    const min = t.os.version_range.semver.min;
+
+    const run = runTool(b, "specialize_availability");
+    const dir = run.addOutputDirectoryArg("include");
+    addInputsDepFile(run);
+    run.addDirectoryArg(include);
+    run.addArg(@tagName(t.cpu.arch));
+    run.addArg(b.fmt("{d}.{d}.{d}", .{ min.major, min.minor, min.patch }));
+    return dir;
+}
+
+/// Returns the symbol index of every stub in the SDK: for each target, the
+/// install name of the library that exports each symbol. Read it with
+/// `tbd.Index` or `tbd.MappedIndex` from the `tbd` module.
+pub fn tbdIndex(b: *std.Build) std.Build.LazyPath {
+    const run = runTool(b, "tbd_index");
+    const index = run.addOutputFileArg("sdk.tbdi");
+    addInputsDepFile(run);
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/Frameworks") });
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/lib") });
+    return index;
+}
+
+/// Returns the SDK's `Frameworks/` and `lib/` with every `.tbd` stub
+/// converted to TAPI v5 (JSON), for linkers that read it (ld64; zig's
+/// linker only reads v4) and for tools that parse stubs with `tbd.parse`.
+/// Headers are left out. v4 does not say which symbols are data, so every
+/// symbol, `_kCFAllocatorDefault` included, is listed under `text`; a
+/// tool that needs the distinction has to get it from the binary.
+pub fn tbdV5(b: *std.Build) std.Build.LazyPath {
+    const run = runTool(b, "tbd_v5");
+    const dir = run.addOutputDirectoryArg("sdk");
+    addInputsDepFile(run);
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/Frameworks") });
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/lib") });
+    return dir;
+}
+
+/// Returns the list of frameworks and libraries that `objects` (Mach-O
+/// objects or static libraries built for `target`) need, found by looking
+/// up their undefined symbols in `tbdIndex`. Check it in and pass it to
+/// `linkNeeded`.
+pub fn neededLibraries(
+    b: *std.Build,
+    objects: []const std.Build.LazyPath,
+    target: std.Build.ResolvedTarget,
+) std.Build.LazyPath {
+    const t = target.result;
+    if (t.os.tag != .macos) std.debug.panic("not a macOS target: {s}", .{@tagName(t.os.tag)});
+    const run = runTool(b, "needed_libraries");
+    const list = run.addOutputFileArg("sdk.link");
+    run.addFileArg(tbdIndex(b));
+    // zig links its own libSystem stub.
+    run.addFileArg(.{ .cwd_relative = b.pathJoin(&.{
+        b.graph.zig_lib_directory.path orelse ".",
+        "libc",
+        "darwin",
+        "libSystem.tbd",
+    }) });
+    run.addArg(switch (t.cpu.arch) {
+        .aarch64 => "arm64-macos",
+        .x86_64 => "x86_64-macos",
+        else => std.debug.panic("no stubs for {s}", .{@tagName(t.cpu.arch)}),
+    });
+    for (objects) |object| run.addFileArg(object);
+    return list;
+}
+
+/// Returns the symbols that `objects` (Mach-O objects or static
+/// libraries) reference and do not define, one per line. Check it in and
+/// pass it as `PathsOptions.stub_symbols`.
+pub fn referencedSymbols(b: *std.Build, objects: []const std.Build.LazyPath) std.Build.LazyPath {
+    const run = runTool(b, "referenced_symbols");
+    const list = run.addOutputFileArg("sdk.symbols");
+    for (objects) |object| run.addFileArg(object);
+    return list;
+}
+
+/// The build options of the `objc` module, imported as "objc_options".
+fn objcOptions(b: *std.Build, msgsend_selector_stubs: bool) *std.Build.Step.Options {
+    const options = b.addOptions();
+    options.addOption(bool, "msgsend_selector_stubs", msgsend_selector_stubs);
+    return options;
+}
+
+/// The frameworks whose classes and protocols `objcShims` wraps.
+pub const objc_shim_frameworks = [_][]const u8{ "Foundation", "AppKit", "QuartzCore", "Metal" };
+
+/// Returns Zig source with a typed wrapper for every method of the classes
+/// and protocols in `objc_shim_frameworks`, generated from their headers
+/// as preprocessed for `target`. It imports the `objc` module as "objc".
+/// With `imp_cache`, every class also gets `Cached` variants that take an
+/// `objc.Cache`.
+pub fn objcShims(b: *std.Build, target: std.Build.ResolvedTarget, imp_cache: bool) std.Build.LazyPath {
+    var imports = std.ArrayList(u8).init(b.allocator);
+    for (objc_shim_frameworks) |name| {
+        imports.writer().print("#import <{s}/{s}.h>\n", .{ name, name }) catch @panic("OOM");
+    }
+    const source = b.addWriteFiles().add("shims.m", imports.items);
+    // Keeps the line markers, which tell the generator which framework
+    // each declaration comes from.
+    const preprocess_run = sdkClang(b, target, .Debug, .objc, .{});
+    addDepFile(preprocess_run);
+    preprocess_run.addArgs(&.{ "-x", "objective-c", "-E" });
+    preprocess_run.addFileArg(source);
+    preprocess_run.addArg("-o");
+    const preprocessed = preprocess_run.addOutputFileArg("shims.i");
+
+    const run = runTool(b, "objc_shims");
+    if (imp_cache) run.addArg("--imp-cache");
+    const out = run.addOutputFileArg("objc_shims.zig");
+    run.addFileArg(preprocessed);
+    run.addArgs(&objc_shim_frameworks);
+    return out;
+}
+
+/// Links the frameworks and libraries listed in a file written by
+/// `neededLibraries`, e.g. `linkNeeded(exe, "sdk.link")`. The path is
+/// relative to the build root.
+pub fn linkNeeded(step: *std.Build.Step.Compile, path: []const u8) void {
+    const b = step.step.owner;
+    const text = b.build_root.handle.readFileAlloc(b.allocator, path, 1 << 20) catch |err|
+        std.debug.panic("unable to read {s}: {s}", .{ path, @errorName(err) });
+    var lines = std.mem.tokenizeAny(u8, text, "\r\n");
+    while (lines.next()) |line| {
+        if (line[0] == '#') continue;
+        if (std.mem.startsWith(u8, line, "framework ")) {
+            step.linkFramework(line["framework ".len..]);
+        } else if (std.mem.startsWith(u8, line, "library ")) {
+            step.linkSystemLibrary(line["library ".len..]);
+        } else std.debug.panic("{s}: not a framework or library: {s}", .{ path, line });
+    }
+}
+
+pub const ProfileOptions = struct {
+    /// The consumer's root headers and sources, or directories to search
+    /// for them. Their `#include <...>`, `#import <...>` and
+    /// `@cInclude("...")` sites are scanned on every build.
+    sources: []const std.Build.LazyPath,
+    lang: Lang = .objc,
+};
+
+/// Returns an SDK profile: the list of SDK files that the headers
+/// `sources` include pull in on aarch64-macos or x86_64-macos, as found
+/// by `zig cc -M`. Install it, check it in and pass it as
+/// `PathsOptions.profile`.
+pub fn sdkProfile(b: *std.Build, options: ProfileOptions) std.Build.LazyPath {
+    const scan = runTool(b, "scan_includes");
+    // Directories are not hashed, so scan them every time.
+    scan.has_side_effects = true;
+    const source = scan.addOutputFileArg("includes.m");
+    for (options.sources) |path| scan.addDirectoryArg(path);
+
+    const manifest = runTool(b, "profile_manifest");
+    const profile = manifest.addOutputFileArg("sdk.profile");
+    manifest.addDirectoryArg(.{ .cwd_relative = sdkPath("/.") });
+    for ([_]std.Target.Cpu.Arch{ .aarch64, .x86_64 }) |arch| {
+        const target = b.resolveTargetQuery(.{ .cpu_arch = arch, .os_tag = .macos });
+        const deps = sdkClang(b, target, .Debug, options.lang, .{});
+        deps.addArgs(&.{ "-x", options.lang.source(), "-M" });
+        deps.addFileArg(source);
+        deps.addArg("-MF");
+        manifest.addFileArg(deps.addOutputFileArg("includes.d"));
+    }
+    return profile;
+}
+
+/// `headers` is the SDK or a copy of it with the same layout.
+fn profileView(b: *std.Build, profile: std.Build.LazyPath, headers: std.Build.LazyPath) std.Build.LazyPath {
+    const run = runTool(b, "profile_view");
+    const view = run.addOutputDirectoryArg("sdk");
+    run.addFileArg(profile);
+    run.addDirectoryArg(headers.path(b, "Frameworks"));
+    run.addDirectoryArg(headers.path(b, "include"));
+    return view;
+}
+
+/// Returns a generated directory that holds only the given frameworks and
+/// the frameworks their headers include, for use as the sole framework
+/// search path. Including anything else is an error instead of a slow,
+/// silent success.
+pub fn frameworkSearchRoot(b: *std.Build, names: []const []const u8) std.Build.LazyPath {
+    return searchRootIn(b, Roots.sdk(b).frameworks, names);
+}
+
+fn searchRootIn(b: *std.Build, frameworks: std.Build.LazyPath, names: []const []const u8) std.Build.LazyPath {
+    const run = runTool(b, "search_root");
+    const root = run.addOutputDirectoryArg("Frameworks");
+    run.addDirectoryArg(frameworks);
+    for (groupClosure(b.allocator, names)) |g| {
+        if (g.isFramework()) run.addArg(g.name);
+    }
+    return root;
+}
+
+/// Returns a clang header map covering `include/` and the headers of the
+/// given frameworks and the frameworks they include, or of every framework
+/// if `frameworks` is null. Add it with `addIncludePath`.
+pub fn headerMap(b: *std.Build, frameworks: ?[]const []const u8) std.Build.LazyPath {
+    return headerMapOf(b, Roots.sdk(b), frameworks);
+}
+
+fn headerMapOf(b: *std.Build, roots: Roots, frameworks: ?[]const []const u8) std.Build.LazyPath {
+    const run = runTool(b, "hmap");
+    const hmap = run.addOutputFileArg("sdk.hmap");
+    run.addDirectoryArg(roots.include);
+    run.addDirectoryArg(roots.frameworks);
+    if (frameworks) |names| {
+        for (groupClosure(b.allocator, names)) |g| {
+            if (g.isFramework()) run.addArg(g.name);
+        }
+    }
+    return hmap;
+}
+
+pub const Lang = enum {
+    c,
+    objc,
+    cxx,
+    objcxx,
+
+    fn source(self: Lang) []const u8 {
+        return switch (self) {
+            .c => "c",
+            .objc => "objective-c",
+            .cxx => "c++",
+            .objcxx => "objective-c++",
+        };
+    }
+
+    fn header(self: Lang) []const u8 {
+        return switch (self) {
+            .c => "c-header",
+            .objc => "objective-c-header",
+            .cxx => "c++-header",
+            .objcxx => "objective-c++-header",
+        };
+    }
+};
+
+pub const PchOptions = struct {
+    /// The header to precompile, e.g. "Cocoa/Cocoa.h".
+    umbrella: []const u8,
+    lang: Lang = .objc,
+    target: std.Build.ResolvedTarget,
+    optimize: std.builtin.OptimizeMode = .Debug,
+
+    /// Macros as "NAME" or "NAME=VALUE".
+    defines: []const []const u8 = &.{},
+
+    /// Other flags that change how headers parse, e.g. "-fobjc-arc".
+    flags: []const []const u8 = &.{},
+    paths: PathsOptions = .{},
+};
+
+/// A precompiled SDK umbrella header. The PCH and every source compiled
+/// against it share one clang command line, so the zig cache keys the PCH
+/// on the target (including the CPU features and the minimum macOS
+/// version), language, optimize mode, defines and flags.
+pub const Pch = struct {
+    b: *std.Build,
+    options: PchOptions,
+    file: std.Build.LazyPath,
+
+    /// Compiles `source` with the PCH included and links the object into
+    /// `step`. `flags` must not change how the PCH's headers parse. Panics
+    /// if `step` is built for another CPU or optimize mode than the PCH.
+    pub fn addCSourceFile(
+        self: Pch,
+        step: *std.Build.Step.Compile,
+        source: std.Build.LazyPath,
+        flags: []const []const u8,
+    ) void {
+        checkStep(step, self.options);
+        const run = self.clang();
+        run.addArgs(&.{ "-x", self.options.lang.source(), "-include-pch" });
+        run.addFileArg(self.file);
+        run.addArgs(flags);
+        run.addArg("-c");
+        run.addFileArg(source);
+        run.addArg("-o");
+        step.addObjectFile(run.addOutputFileArg("out.o"));
+    }
+
+    fn clang(self: Pch) *std.Build.Step.Run {
+        const run = configuredClang(self.b, self.options);
+        addDepFile(run);
+        return run;
+    }
+};
+
+/// Precompiles an SDK umbrella header into the zig cache. Compile sources
+/// that should use it with `Pch.addCSourceFile`.
+pub fn addSdkPch(b: *std.Build, options: PchOptions) Pch {
+    const wf = b.addWriteFiles();
+    const header = wf.add("sdk_pch.h", b.fmt("#include <{s}>\n", .{options.umbrella}));
+
+    var pch: Pch = .{ .b = b, .options = options, .file = undefined };
+    const run = pch.clang();
+    run.addArgs(&.{ "-x", options.lang.header() });
+    run.addFileArg(header);
+    run.addArg("-o");
+    pch.file = run.addOutputFileArg("sdk.pch");
+    return pch;
+}
+
+pub const ModulesOptions = struct {
+    /// Modules to prebuild: framework names and "Darwin" for the libc
+    /// headers the frameworks use.
+    modules: []const []const u8,
+    lang: Lang = .objc,
+    target: std.Build.ResolvedTarget,
+    optimize: std.builtin.OptimizeMode = .Debug,
+
+    /// Macros as "NAME" or "NAME=VALUE".
+    defines: []const []const u8 = &.{},
+
+    /// Other flags that change how headers parse, e.g. "-fobjc-arc".
+    flags: []const []const u8 = &.{},
+    paths: PathsOptions = .{},
+};
+
+/// Clang modules for SDK frameworks, prebuilt into the zig cache from the
+/// module maps in modules/. As with `Pch`, the modules and every source
+/// compiled against them share one clang command line.
+pub const Modules = struct {
+    b: *std.Build,
+    options: ModulesOptions,
+    overlay: std.Build.LazyPath,
+    cache: std.Build.LazyPath,
+
+    /// Compiles `source` with `-fmodules`, reading the prebuilt modules,
+    /// and links the object into `step`. Panics if `step` is built for
+    /// another CPU or optimize mode than the modules.
+    pub fn addCSourceFile(
+        self: Modules,
+        step: *std.Build.Step.Compile,
+        source: std.Build.LazyPath,
+        flags: []const []const u8,
+    ) void {
+        checkStep(step, self.options);
+        const run = self.clang();
+        addDepFile(run);
+        run.addArgs(&.{ "-x", self.options.lang.source(), "-fprebuilt-implicit-modules" });
+        run.addPrefixedDirectoryArg("-fprebuilt-module-path=", self.cache);
+
+        // Modules that were not prebuilt are built here instead.
+        _ = run.addPrefixedOutputDirectoryArg("-fmodules-cache-path=", "modules");
+        run.addArgs(flags);
+        run.addArg("-c");
+        run.addFileArg(source);
+        run.addArg("-o");
+        step.addObjectFile(run.addOutputFileArg("out.o"));
+    }
+
+    fn clang(self: Modules) *std.Build.Step.Run {
+        const run = configuredClang(self.b, self.options);
+        run.addArgs(&.{ "-fmodules", "-ivfsoverlay" });
+        run.addFileArg(self.overlay);
+        return run;
+    }
+};
+
+/// Prebuilds clang modules for SDK frameworks into the zig cache. Compile
+/// sources that should use them with `Modules.addCSourceFile`.
+pub fn addSdkModules(b: *std.Build, options: ModulesOptions) Modules {
+    var imports = std.ArrayList(u8).init(b.allocator);
+    for (options.modules) |name| {
+        imports.writer().print("#pragma clang module import {s}\n", .{name}) catch @panic("OOM");
+    }
+    const wf = b.addWriteFiles();
+    const source = wf.add("modules.c", imports.items);
+
+    var modules: Modules = .{
+        .b = b,
+        .options = options,
+        .overlay = moduleOverlay(b, options.paths),
+        .cache = undefined,
+    };
+    const run = modules.clang();
+    run.addArgs(&.{ "-x", options.lang.source(), "-fsyntax-only" });
+    modules.cache = run.addPrefixedOutputDirectoryArg("-fmodules-cache-path=", "modules");
+    run.addFileArg(source);
+    return modules;
+}
+
+/// Returns a clang VFS overlay that places the module maps in modules/
+/// over the SDK. Pass it with `-ivfsoverlay`.
+pub fn moduleOverlay(b: *std.Build, paths: PathsOptions) std.Build.LazyPath {
+    const run = runTool(b, "vfs_overlay");
+    const overlay = run.addOutputFileArg("overlay.yaml");
+    run.addDirectoryArg(.{ .cwd_relative = sdkPath("/modules") });
+    const roots = Roots.init(b, paths, null);
+    run.addPrefixedDirectoryArg("include=", roots.include);
+    if (paths.frameworks) |names| {
+        run.addPrefixedDirectoryArg("Frameworks=", searchRootIn(b, roots.frameworks, names));
+    } else {
+        run.addPrefixedDirectoryArg("Frameworks=", roots.frameworks);
+    }
+    return overlay;
+}
+
+/// `sdkClang` plus the options of a `PchOptions` or `ModulesOptions` that
+/// change how headers parse.
+fn configuredClang(b: *std.Build, options: anytype) *std.Build.Step.Run {
+    const run = sdkClang(b, options.target, options.optimize, options.lang, options.paths);
+    for (options.defines) |define| run.addArg(b.fmt("-D{s}", .{define}));
+    run.addArgs(options.flags);
+    return run;
+}
+
+/// Panics unless `step` compiles for the CPU and optimize mode that the
+/// `PchOptions` or `ModulesOptions` were built with. Clang rejects a PCH
+/// or module built for other CPU features or another -O level, and an
+/// object built for them would not match the rest of the step.
+fn checkStep(step: *std.Build.Step.Compile, options: anytype) void {
+    const m = step.root_module;
+    const cpu = options.target.result.cpu;
+    if (m.resolved_target) |target| {
+        const step_cpu = target.result.cpu;
+        if (step_cpu.arch != cpu.arch or step_cpu.model != cpu.model or !step_cpu.features.eql(cpu.features))
+            std.debug.panic("{s}: built for another CPU than the SDK PCH or modules", .{step.name});
+    }
+    if (m.optimize) |optimize| {
+        if (optimize != options.optimize)
+            std.debug.panic("{s}: built {s}, the SDK PCH or modules {s}", .{ step.name, @tagName(optimize), @tagName(options.optimize) });
+    }
+}
+
+fn addDepFile(run: *std.Build.Step.Run) void {
+    run.addArg("-MD");
+    _ = run.addPrefixedDepFileOutputArg("-MF", "out.d");
+}
+
+/// For the tools that read the SDK through directory arguments, which the
+/// zig cache keys by path alone: the tool lists the files it reads in
+/// this depfile (see src/dep_file.zig), so that the run is cached on
+/// their contents and reruns after `update.sh` changes them.
+fn addInputsDepFile(run: *std.Build.Step.Run) void {
+    _ = run.addDepFileOutputArg("inputs.d");
+}
+
+/// Returns a run of zig's bundled clang for `target` with only the SDK on
+/// the search path. Unlike `zig cc` it adds no flags or headers of its
+/// own, so what it produces (PCHs, modules) can be reused by any other
+/// run with the same arguments.
+fn sdkClang(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    optimize: std.builtin.OptimizeMode,
+    lang: Lang,
+    paths: PathsOptions,
+) *std.Build.Step.Run {
+    const run = b.addSystemCommand(&.{ b.graph.zig_exe, "clang" });
+    addSdkClangArgs(run, target, optimize, lang, paths);
+    return run;
+}
+
+/// The arguments of `sdkClang`, for runs of a tool that wraps clang.
+fn addSdkClangArgs(
+    run: *std.Build.Step.Run,
+    target: std.Build.ResolvedTarget,
+    optimize: std.builtin.OptimizeMode,
+    lang: Lang,
+    paths: PathsOptions,
+) void {
+    const b = run.step.owner;
+    const t = target.result;
+    if (t.os.tag != .macos) std.debug.panic("not a macOS target: {s}", .{@tagName(t.os.tag)});
+    const min = t.os.version_range.semver.min;
+
+    run.addArgs(&.{
+        "-target",
+        b.fmt("{s}-apple-macos{d}.{d}.{d}", .{ @tagName(t.cpu.arch), min.major, min.minor, min.patch }),
+        "-resource-dir",
+        b.graph.zig_lib_directory.path orelse ".",
+        "-nostdlibinc",
+        switch (optimize) {
+            .Debug => "-O0",
+            .ReleaseSafe, .ReleaseFast => "-O2",
+            .ReleaseSmall => "-Os",
+        },
+    });
+    // The CPU, its features and debug info as `zig cc` passes them for a
+    // Compile step with this target and optimize mode, so that objects
+    // match the step's own C objects and a PCH is accepted by them.
+    run.addArgs(&.{ "-Xclang", "-target-cpu", "-Xclang", t.cpu.model.llvm_name orelse "generic" });
+    for (t.cpu.arch.allFeaturesList(), 0..) |feature, i| {
+        const name = feature.llvm_name orelse continue;
+        const sign: u8 = if (t.cpu.features.isEnabled(@intCast(i))) '+' else '-';
+        run.addArgs(&.{ "-Xclang", "-target-feature", "-Xclang", b.fmt("{c}{s}", .{ sign, name }) });
+    }
+    if (optimize != .ReleaseSmall) run.addArg("-g");
+
+    // Compiling only, so the stubs do not matter.
+    const roots = Roots.init(b, paths, null);
+    if (paths.header_map) run.addPrefixedFileArg("-I", headerMapOf(b, roots, paths.frameworks));
+    run.addArg("-iframework");
+    if (paths.frameworks) |names| {
+        run.addDirectoryArg(searchRootIn(b, roots.frameworks, names));
+    } else {
+        run.addDirectoryArg(roots.frameworks);
+    }
+    // -nostdlibinc drops libc++ too, and it has to come before libc.
+    if (lang == .cxx or lang == .objcxx) {
+        run.addArg("-isystem");
+        run.addDirectoryArg(roots.include.path(b, "c++/v1"));
+    }
+    if (paths.availability) {
+        run.addArg("-isystem");
+        run.addDirectoryArg(availabilityHeaders(b, target, roots.include).?);
+    }
+    run.addArg("-isystem");
+    run.addDirectoryArg(roots.include);
+}
+
+/// A part of the SDK that can be published and fetched as its own lazy
+/// package (see `split.sh`). Every framework is a group, as are the
+/// largest directories under `include/`. Everything else is "core" and
+/// always ships with this package.
+pub const Group = struct {
+    name: []const u8,
+
+    /// Path of the group's directory relative to the SDK root.
+    path: []const u8,
+
+    /// Groups whose headers are included by this group's headers.
+    deps: []const []const u8 = &.{},
+
+    /// The name of the lazy dependency in build.zig.zon that provides
+    /// this group when the SDK is split, e.g. "sdk_cxx" for "c++".
+    pub fn depName(self: Group, allocator: std.mem.Allocator) []u8 {
+        const name = std.fmt.allocPrint(allocator, "sdk_{s}", .{self.name}) catch @panic("OOM");
+        std.mem.replaceScalar(u8, name, '+', 'x');
+        std.mem.replaceScalar(u8, name, '-', '_');
+        return name;
+    }
+
+    pub fn isFramework(self: Group) bool {
+        return std.mem.startsWith(u8, self.path, "Frameworks/");
+    }
+};
+
+pub const groups = [_]Group{
+    .{ .name = "AppKit", .path = "Frameworks/AppKit.framework", .deps = &.{ "ApplicationServices", "CoreData", "CoreFoundation", "CoreGraphics", "CoreImage", "CoreText", "Foundation", "IOKit", "OpenGL", "QuartzCore", "Symbols", "mach" } },
+    .{ .name = "ApplicationServices", .path = "Frameworks/ApplicationServices.framework", .deps = &.{ "ColorSync", "CoreFoundation", "CoreGraphics", "CoreServices", "CoreText", "Foundation", "ImageIO" } },
+    .{ .name = "AudioToolbox", .path = "Frameworks/AudioToolbox.framework", .deps = &.{ "Carbon", "CoreAudio", "CoreAudioTypes", "CoreFoundation", "Foundation" } },
+    .{ .name = "AudioUnit", .path = "Frameworks/AudioUnit.framework", .deps = &.{"AudioToolbox"} },
+    .{ .name = "CFNetwork", .path = "Frameworks/CFNetwork.framework", .deps = &.{"CoreFoundation"} },
+    .{ .name = "Carbon", .path = "Frameworks/Carbon.framework", .deps = &.{ "ApplicationServices", "CoreFoundation", "CoreServices", "Foundation", "Security" } },
+    .{ .name = "CloudKit", .path = "Frameworks/CloudKit.framework", .deps = &.{ "CoreLocation", "Foundation" } },
+    .{ .name = "Cocoa", .path = "Frameworks/Cocoa.framework", .deps = &.{ "AppKit", "CoreData", "Foundation" } },
+    .{ .name = "ColorSync", .path = "Frameworks/ColorSync.framework", .deps = &.{"CoreFoundation"} },
+    .{ .name = "CoreAudio", .path = "Frameworks/CoreAudio.framework", .deps = &.{ "CoreAudioTypes", "CoreFoundation", "Foundation", "IOKit" } },
+    .{ .name = "CoreAudioTypes", .path = "Frameworks/CoreAudioTypes.framework", .deps = &.{"CoreFoundation"} },
+    .{ .name = "CoreData", .path = "Frameworks/CoreData.framework", .deps = &.{ "CloudKit", "Foundation" } },
+    .{ .name = "CoreFoundation", .path = "Frameworks/CoreFoundation.framework", .deps = &.{"mach"} },
+    .{ .name = "CoreGraphics", .path = "Frameworks/CoreGraphics.framework", .deps = &.{ "CoreFoundation", "IOKit", "mach" } },
+    .{ .name = "CoreImage", .path = "Frameworks/CoreImage.framework", .deps = &.{ "CoreGraphics", "CoreVideo", "Foundation", "IOSurface", "ImageIO", "Metal", "OpenGL" } },
+    .{ .name = "CoreLocation", .path = "Frameworks/CoreLocation.framework", .deps = &.{"Foundation"} },
+    .{ .name = "CoreServices", .path = "Frameworks/CoreServices.framework", .deps = &.{ "CFNetwork", "CoreFoundation", "DiskArbitration", "Security", "mach" } },
+    .{ .name = "CoreText", .path = "Frameworks/CoreText.framework", .deps = &.{ "CoreFoundation", "CoreGraphics" } },
+    .{ .name = "CoreVideo", .path = "Frameworks/CoreVideo.framework", .deps = &.{ "ApplicationServices", "CoreFoundation", "CoreGraphics", "IOSurface", "Metal", "OpenGL" } },
+    .{ .name = "DiskArbitration", .path = "Frameworks/DiskArbitration.framework", .deps = &.{ "CoreFoundation", "IOKit", "mach" } },
+    .{ .name = "Foundation", .path = "Frameworks/Foundation.framework", .deps = &.{ "CFNetwork", "CoreFoundation", "CoreGraphics", "CoreServices", "Security" } },
+    .{ .name = "GameController", .path = "Frameworks/GameController.framework", .deps = &.{ "AppKit", "Foundation", "IOKit" } },
+    .{ .name = "IOKit", .path = "Frameworks/IOKit.framework", .deps = &.{ "CoreFoundation", "mach" } },
+    .{ .name = "IOSurface", .path = "Frameworks/IOSurface.framework", .deps = &.{ "CoreFoundation", "Foundation", "IOKit", "mach" } },
+    .{ .name = "ImageIO", .path = "Frameworks/ImageIO.framework", .deps = &.{ "CoreFoundation", "CoreGraphics" } },
+    .{ .name = "Kernel", .path = "Frameworks/Kernel.framework", .deps = &.{ "CoreServices", "IOKit", "mach" } },
+    .{ .name = "Metal", .path = "Frameworks/Metal.framework", .deps = &.{ "Foundation", "IOSurface", "mach" } },
+    .{ .name = "OpenGL", .path = "Frameworks/OpenGL.framework" },
+    .{ .name = "QuartzCore", .path = "Frameworks/QuartzCore.framework", .deps = &.{ "CoreFoundation", "CoreGraphics", "CoreImage", "CoreVideo", "Foundation", "Metal", "OpenGL", "mach" } },
+    .{ .name = "Security", .path = "Frameworks/Security.framework", .deps = &.{ "CoreFoundation", "mach" } },
+    .{ .name = "Symbols", .path = "Frameworks/Symbols.framework", .deps = &.{"Foundation"} },
+    .{ .name = "c++", .path = "include/c++" },
+    .{ .name = "simd", .path = "include/simd" },
+    .{ .name = "net-snmp", .path = "include/net-snmp" },
+    .{ .name = "apr-1", .path = "include/apr-1" },
+    .{ .name = "unicode", .path = "include/unicode" },
+    .{ .name = "mach", .path = "include/mach" },
+    .{ .name = "libxml", .path = "include/libxml" },
+    .{ .name = "libxslt", .path = "include/libxslt", .deps = &.{"libxml"} },
+    .{ .name = "libexslt", .path = "include/libexslt", .deps = &.{ "libxml", "libxslt" } },
+    .{ .name = "odmodule", .path = "include/odmodule", .deps = &.{ "CoreFoundation", "Foundation", "Security" } },
+    .{ .name = "Spatial", .path = "include/Spatial", .deps = &.{"simd"} },
+};
+
+/// Groups that headers of the core include, such as `<mach/...>` from
+/// `<signal.h>`. `addGroups` always adds them.
+pub const core_deps = [_][]const u8{ "CoreFoundation", "mach" };
+
+/// Adds the search paths for only the given groups (and the groups they
+/// depend on) plus the core of the SDK and `core_deps`. `sdk` is the
+/// dependency on this package, e.g. `b.dependency("macos_sdk", .{})`.
+///
+/// Groups are fetched lazily only from the package `split.sh` writes,
+/// whose build.zig.zon declares each of them as a lazy dependency. This
+/// repository declares none: every group is in the tree, and `addGroups`
+/// only narrows the framework search path. `zig build verify-groups`
+/// checks that the groups and their deps cover every header.
+pub fn addGroups(
+    sdk: *std.Build.Dependency,
+    step: *std.Build.Step.Compile,
+    names: []const []const u8,
+) void {
+    addGroupsModule(sdk, step.root_module, names);
+}
+
+pub fn addGroupsModule(
+    sdk: *std.Build.Dependency,
+    m: *std.Build.Module,
+    names: []const []const u8,
+) void {
+    const b = sdk.builder;
+    m.addSystemIncludePath(b.path("include"));
+    m.addLibraryPath(b.path("lib"));
+
+    const wanted = std.mem.concat(b.allocator, []const u8, &.{ &core_deps, names }) catch @panic("OOM");
+    var in_tree_frameworks = false;
+    for (groupClosure(b.allocator, wanted)) |g| {
+        const dep_name = g.depName(b.allocator);
+        if (!isDeclared(b, dep_name)) {
+            // Groups in the tree live under roots we add once.
+            if (g.isFramework() and !in_tree_frameworks) {
+                m.addSystemFrameworkPath(b.path("Frameworks"));
+                in_tree_frameworks = true;
+            }
+            continue;
+        }
+
+        // Null until fetched; the build runner fetches the package and
+        // runs the build again.
+        const dep = b.lazyDependency(dep_name, .{}) orelse continue;
+        if (g.isFramework()) {
+            m.addSystemFrameworkPath(dep.path(""));
+        } else {
+            m.addSystemIncludePath(dep.path(""));
+        }
+    }
+}
+
+/// Returns the requested groups and everything they depend on, in the
+/// order of `groups`. Panics on unknown group names.
+pub fn groupClosure(allocator: std.mem.Allocator, names: []const []const u8) []const Group {
+    var wanted = [_]bool{false} ** groups.len;
+    var stack = std.ArrayList([]const u8).init(allocator);
+    defer stack.deinit();
+    stack.appendSlice(names) catch @panic("OOM");
+
+    while (stack.pop()) |name| {
+        const idx = for (groups, 0..) |g, i| {
+            if (std.mem.eql(u8, g.name, name)) break i;
+        } else std.debug.panic("unknown macOS SDK group: {s}", .{name});
+        if (wanted[idx]) continue;
+        wanted[idx] = true;
+        stack.appendSlice(groups[idx].deps) catch @panic("OOM");
+    }
+
+    var result = std.ArrayList(Group).init(allocator);
+    for (groups, wanted) |g, w| {
+        if (w) result.append(g) catch @panic("OOM");
+    }
+    return result.toOwnedSlice() catch @panic("OOM");
+}
+
+fn isDeclared(b: *std.Build, dep_name: []const u8) bool {
+    for (b.available_deps) |dep| {
+        if (std.mem.eql(u8, dep[0], dep_name)) return true;
+    }
+    return false;
+}
+
+/// Runs one of the generators in src/ on the host. Each tool is compiled
+/// once per build, however many steps run it.
+fn runTool(b: *std.Build, comptime name: []const u8) *std.Build.Step.Run {
+    const Tool = struct {
+        const source = "/src/" ++ name ++ ".zig";
+        var exe: ?*std.Build.Step.Compile = null;
+    };
+    if (Tool.exe == null) Tool.exe = toolExe(b, name, Tool.source);
+    return b.addRunArtifact(Tool.exe.?);
+}
+
+fn toolExe(b: *std.Build, name: []const u8, comptime source: []const u8) *std.Build.Step.Compile {
+    const exe = b.addExecutable(.{
+        .name = name,
+        .root_source_file = .{ .cwd_relative = sdkPath(source) },
+        .target = b.graph.host,
+        .optimize = .ReleaseSafe,
+    });
+    // For the tools that read stubs.
+    exe.root_module.addImport("tbd", b.createModule(.{
+        .root_source_file = .{ .cwd_relative = sdkPath("/src/tbd.zig") },
+    }));
+    // For the tools that read objects.
+    exe.root_module.addImport("object_symbols", b.createModule(.{
+        .root_source_file = .{ .cwd_relative = sdkPath("/src/object_symbols.zig") },
+    }));
+    // For the tools that read the SDK through directory arguments.
+    exe.root_module.addImport("dep_file", b.createModule(.{
+        .root_source_file = .{ .cwd_relative = sdkPath("/src/dep_file.zig") },
+    }));
+    return exe;
+}
+
 fn sdkPath(comptime suffix: []const u8) []const u8 {
     if (suffix[0] != '/') @compileError("suffix must be an absolute path");
     return comptime blk: {
@@ -0,0 +1,50 @@
+#!/usr/bin/env bash
+# Splits the SDK into a core package plus one lazily fetched package per
+# entry in `groups` in build.zig. Upload the contents of the output
+# directory to <base-url> and depend on macos_sdk.tar.gz.
+set -euo pipefail
+
+base_url=${1:?usage: ./split.sh <base-url> [out-dir]}
+out=${2:-zig-out/split}
+
+# A header in no group, or including a group outside its deps, would be
+# missing for consumers of the split package.
+zig build verify-groups
+
+rm -rf "$out"
+mkdir -p "$out/core"
+
+# The core starts out as everything the root package ships
+cp -R build.zig build.zig.zon stub.c Frameworks include lib modules LICENSE README.md "$out/core/"
+if [ -d src ]; then cp -R src "$out/core/"; fi
+
+deps=""
+while read -r name path; do
+  dep="sdk_${name//+/x}"
+  dep="${dep//-/_}"
+
+  # Archived with its parent (Frameworks/ or include/) as the only
+  # top-level directory, which zig fetch strips. The package root then
+  # holds the group directory itself, so it can be passed straight to
+  # -F or -isystem.
+  tar -czf "$out/$dep.tar.gz" "$path"
+  rm -rf "${out:?}/core/$path"
+
+  hash=$(zig fetch "$out/$dep.tar.gz")
+  deps+="        .$dep = .{\n"
+  deps+="            .url = \"$base_url/$dep.tar.gz\",\n"
+  deps+="            .hash = \"$hash\",\n"
+  deps+="            .lazy = true,\n"
+  deps+="        },\n"
+done < <(grep -oE '\.name = "[^"]+", \.path = "[^"]+"' build.zig |
+  sed -E 's/\.name = "([^"]+)", \.path = "([^"]+)"/\1 \2/')
+
+printf '%b' "$deps" > "$out/deps.zon"
+awk -v deps="$out/deps.zon" '
+  { print }
+  /^    \.dependencies = \.\{/ { while ((getline line < deps) > 0) print line }
+' build.zig.zon > "$out/core/build.zig.zon"
+rm "$out/deps.zon"
+
+tar -C "$out/core" -czf "$out/macos_sdk.tar.gz" .
+rm -rf "${out:?}/core"
@@ -0,0 +1,52 @@
+//! Collects the records written by bench_tu into one JSON report, sorted
+//! by label.
+//!
+//! Usage: bench_report <out.json> <record.json>...
+const std = @import("std");
+const Record = @import("bench_tu.zig").Record;
+
+const Entry = struct {
+    label: []const u8,
+    ok: bool,
+    wall_ms: f64,
+    max_rss_bytes: ?usize,
+    /// The -ftime-trace output, relative to the report.
+    trace: []const u8,
+};
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 2) {
+        std.log.err("usage: {s} <out.json> <record.json>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var entries = std.ArrayList(Entry).init(arena);
+    for (args[2..]) |path| {
+        const text = try std.fs.cwd().readFileAlloc(arena, path, std.math.maxInt(u32));
+        const record = try std.json.parseFromSliceLeaky(Record, arena, text, .{});
+        try entries.append(.{
+            .label = record.label,
+            .ok = record.ok,
+            .wall_ms = record.wall_ms,
+            .max_rss_bytes = record.max_rss_bytes,
+            .trace = try std.fmt.allocPrint(arena, "{s}.json", .{record.label}),
+        });
+    }
+    std.mem.sort(Entry, entries.items, {}, struct {
+        fn lessThan(_: void, a: Entry, b: Entry) bool {
+            return std.mem.lessThan(u8, a.label, b.label);
+        }
+    }.lessThan);
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    try std.json.stringify(entries.items, .{ .whitespace = .indent_2 }, buf.writer());
+    try buf.writer().writeByte('\n');
+    try buf.flush();
+}
@@ -0,0 +1,62 @@
+//! Runs a clang command once with `-ftime-trace` and records its wall
+//! time, peak RSS and exit status as JSON. Its stderr (diagnostics, `-H`
+//! output) is saved too.
+//!
+//! Usage: bench_tu <record.json> <trace.json> <stderr.txt> <label> <clang-command>...
+//!
+//! A failing command is recorded rather than reported as an error, so one
+//! broken umbrella does not hide the numbers of the others.
+const std = @import("std");
+
+pub const Record = struct {
+    label: []const u8,
+    ok: bool,
+    wall_ms: f64,
+    /// Null where the OS does not report it.
+    max_rss_bytes: ?usize,
+};
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 6) {
+        std.log.err("usage: {s} <record.json> <trace.json> <stderr.txt> <label> <clang-command>...", .{args[0]});
+        std.process.exit(1);
+    }
+    const trace_path = args[2];
+
+    var argv = std.ArrayList([]const u8).init(arena);
+    try argv.appendSlice(args[5..]);
+    try argv.append(try std.fmt.allocPrint(arena, "-ftime-trace={s}", .{trace_path}));
+
+    var child = std.process.Child.init(argv.items, arena);
+    child.stdin_behavior = .Ignore;
+    child.stdout_behavior = .Ignore;
+    child.stderr_behavior = .Pipe;
+    child.request_resource_usage_statistics = true;
+
+    var timer = try std.time.Timer.start();
+    try child.spawn();
+    const stderr = try child.stderr.?.reader().readAllAlloc(arena, std.math.maxInt(u32));
+    const term = try child.wait();
+    const elapsed = timer.read();
+    try std.fs.cwd().writeFile(.{ .sub_path = args[3], .data = stderr });
+
+    // clang writes no trace if it fails early.
+    std.fs.cwd().access(trace_path, .{}) catch {
+        try std.fs.cwd().writeFile(.{ .sub_path = trace_path, .data = "{\"traceEvents\":[]}\n" });
+    };
+
+    const record: Record = .{
+        .label = args[4],
+        .ok = term == .Exited and term.Exited == 0,
+        .wall_ms = @as(f64, @floatFromInt(elapsed)) / std.time.ns_per_ms,
+        .max_rss_bytes = child.resource_usage_statistics.getMaxRss(),
+    };
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    try std.json.stringify(record, .{}, file.writer());
+}
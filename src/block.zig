@@ -0,0 +1,440 @@
+//! Block literals for Zig code, laid out as clang lays out `^{ ... }` for
+//! the Blocks ABI of <Block.h>.
+//!
+//! `global(invoke)` is a block that captures nothing. Like clang's, it is a
+//! constant with `_NSConcreteGlobalBlock` as its class, which `_Block_copy`
+//! returns as is, so it never allocates. `Stack(Context, invoke)` is a
+//! block that captures a `Context` by value and lives wherever the literal
+//! is declared, normally on the stack. A method that keeps the block, such
+//! as `addCompletedHandler:` or `dispatch_async`, copies it to the heap
+//! with `_Block_copy`; one that only calls it, such as `dispatch_sync` or
+//! `enumerateObjectsUsingBlock:`, does not, and nothing is allocated:
+//!
+//! ```zig
+//! var done = block.Stack(Frame, Frame.completed).init(.{ .renderer = r, .index = i });
+//! shims.MTLCommandBuffer.addCompletedHandler_(commands, &done);
+//! ```
+//!
+//! `call` calls a block made elsewhere, e.g. one passed to Zig code as a
+//! completion handler.
+//!
+//! Importable from build scripts as `b.dependency("macos_sdk", .{}).module("block")`.
+const std = @import("std");
+const builtin = @import("builtin");
+const objc = @import("objc");
+
+/// A block without captures that calls `invoke` with its arguments.
+/// `invoke` is a Zig function whose parameters and result have C
+/// equivalents, e.g. `fn (objc.id) void` for a Metal completion handler.
+pub fn global(comptime invoke: anytype) *const Global(invoke) {
+    return &Global(invoke).literal;
+}
+
+/// The type of `global(invoke)`.
+pub fn Global(comptime invoke: anytype) type {
+    const Fn = @typeInfo(@TypeOf(invoke)).@"fn";
+    const params = paramTypes(Fn.params);
+    return extern struct {
+        header: Header,
+
+        const Self = @This();
+        const descriptor: Descriptor(false) = .{
+            .size = @sizeOf(Self),
+            .signature = signature(Fn.return_type.?, params),
+        };
+        const literal: Self = .{ .header = .{
+            .isa = &_NSConcreteGlobalBlock,
+            .flags = BLOCK_IS_GLOBAL | blockFlags(Fn.return_type.?),
+            .invoke = trampoline(Self, Fn.return_type.?, params, forward),
+            .descriptor = &descriptor,
+        } };
+
+        fn forward(_: *Self, args: anytype) Fn.return_type.? {
+            return @call(.auto, invoke, args);
+        }
+    };
+}
+
+/// A block that captures a `Context` and calls `invoke` with a pointer to
+/// it and the block's arguments: `fn (context: *Context, buffer: objc.id) void`.
+/// `Context` fields of type `objc.id` or `?objc.id` are retained by the
+/// heap copy and released with it, as clang does for captured objects.
+/// Nothing else in the context is; a copy only moves its bytes. Like
+/// clang's, the size in the descriptor ends at the last capture, so a
+/// heap copy may not have the padding after it: access the context of a
+/// copy through its fields.
+pub fn Stack(comptime Context: type, comptime invoke: anytype) type {
+    const Fn = @typeInfo(@TypeOf(invoke)).@"fn";
+    if (Fn.params.len == 0 or Fn.params[0].type.? != *Context)
+        @compileError("the first parameter of a block's function must be *" ++ @typeName(Context));
+    const params = paramTypes(Fn.params[1..]);
+    const objects = objectFields(Context);
+    const helpers = objects.len > 0;
+    return extern struct {
+        header: Header,
+        // Keeps `Context` in its own layout, which an extern struct could
+        // not hold if `Context` is not extern.
+        context: [@sizeOf(Context)]u8 align(@alignOf(Context)),
+
+        const Self = @This();
+        const descriptor: Descriptor(helpers) = if (helpers) .{
+            .size = @sizeOf(Header) + capturesSize(Context),
+            .copy = @ptrCast(&copyHelper),
+            .dispose = @ptrCast(&disposeHelper),
+            .signature = signature(Fn.return_type.?, params),
+        } else .{
+            .size = @sizeOf(Header) + capturesSize(Context),
+            .signature = signature(Fn.return_type.?, params),
+        };
+
+        /// The literal capturing `context`. Pass a pointer to a variable
+        /// holding it; it must outlive any call that does not copy it.
+        pub fn init(context: Context) Self {
+            var literal: Self = .{
+                .header = .{
+                    .isa = &_NSConcreteStackBlock,
+                    .flags = (if (helpers) BLOCK_HAS_COPY_DISPOSE else 0) | blockFlags(Fn.return_type.?),
+                    .invoke = trampoline(Self, Fn.return_type.?, params, forward),
+                    .descriptor = &descriptor,
+                },
+                .context = undefined,
+            };
+            literal.contextPtr().* = context;
+            return literal;
+        }
+
+        /// The captured context, which `invoke` receives.
+        pub fn contextPtr(literal: *Self) *Context {
+            return @ptrCast(@alignCast(&literal.context));
+        }
+
+        fn forward(literal: *Self, args: anytype) Fn.return_type.? {
+            return @call(.auto, invoke, .{literal.contextPtr()} ++ args);
+        }
+
+        // After `_Block_copy` has moved the bytes of `src` to `dst`.
+        fn copyHelper(dst: *Self, src: *Self) callconv(.c) void {
+            inline for (objects) |name| {
+                _Block_object_assign(
+                    @ptrCast(&@field(dst.contextPtr(), name)),
+                    @field(src.contextPtr(), name),
+                    BLOCK_FIELD_IS_OBJECT,
+                );
+            }
+        }
+
+        fn disposeHelper(literal: *Self) callconv(.c) void {
+            inline for (objects) |name| {
+                _Block_object_dispose(@field(literal.contextPtr(), name), BLOCK_FIELD_IS_OBJECT);
+            }
+        }
+    };
+}
+
+/// A heap copy of `block`, a pointer to any block, that stays valid until
+/// `release`. Copying a global block or a heap copy only adds a reference.
+pub fn copy(block: anytype) @TypeOf(block) {
+    return @ptrCast(@alignCast(_Block_copy(block).?));
+}
+
+pub fn release(block: anytype) void {
+    _Block_release(block);
+}
+
+/// Calls `block` with the arguments in the tuple `args` and returns its
+/// result. The types must be the block's own: a block of type
+/// `void (^)(id<MTLCommandBuffer>)` is called as `call(void, handler, .{buffer})`.
+pub inline fn call(comptime Return: type, block: *const anyopaque, args: anytype) Return {
+    const header: *const Header = @ptrCast(@alignCast(block));
+    const invoke: *const InvokeFn(Return, @TypeOf(args)) = @ptrCast(header.invoke);
+    return @call(.auto, invoke, .{block} ++ args);
+}
+
+/// `struct Block_layout` from libclosure: what every block starts with.
+/// The captures follow it.
+const Header = extern struct {
+    isa: *const anyopaque,
+    flags: c_int,
+    reserved: c_int = 0,
+    /// Takes the block itself, then the block's arguments.
+    invoke: *const fn () callconv(.c) void,
+    descriptor: *const anyopaque,
+};
+
+/// The block descriptor clang emits: the copy and dispose helpers only with
+/// `BLOCK_HAS_COPY_DISPOSE`, then the signature and the extended layout,
+/// which is only read with `BLOCK_HAS_EXTENDED_LAYOUT`.
+fn Descriptor(comptime helpers: bool) type {
+    return if (helpers) extern struct {
+        reserved: c_ulong = 0,
+        size: c_ulong,
+        copy: *const fn (dst: *anyopaque, src: *anyopaque) callconv(.c) void,
+        dispose: *const fn (src: *anyopaque) callconv(.c) void,
+        signature: [*:0]const u8,
+        layout: ?*const anyopaque = null,
+    } else extern struct {
+        reserved: c_ulong = 0,
+        size: c_ulong,
+        signature: [*:0]const u8,
+        layout: ?*const anyopaque = null,
+    };
+}
+
+// libclosure's Block_private.h
+const BLOCK_HAS_COPY_DISPOSE = 1 << 25;
+const BLOCK_IS_GLOBAL = 1 << 28;
+const BLOCK_USE_STRET = 1 << 29;
+const BLOCK_HAS_SIGNATURE = 1 << 30;
+const BLOCK_FIELD_IS_OBJECT = 3;
+
+/// The flags clang sets on every block returning `Return`.
+fn blockFlags(comptime Return: type) c_int {
+    const stret = builtin.cpu.arch == .x86_64 and switch (@typeInfo(Return)) {
+        .@"struct", .@"union", .array => @sizeOf(Return) > 16,
+        else => false,
+    };
+    return BLOCK_HAS_SIGNATURE | @as(c_int, if (stret) BLOCK_USE_STRET else 0);
+}
+
+/// The C function a block's `invoke` points to, which takes the block
+/// before the block's arguments.
+fn InvokeFn(comptime Return: type, comptime Args: type) type {
+    const fields = @typeInfo(Args).@"struct".fields;
+    var params: [fields.len + 1]std.builtin.Type.Fn.Param = undefined;
+    params[0] = .{ .is_generic = false, .is_noalias = false, .type = *const anyopaque };
+    for (fields, params[1..]) |field, *param| {
+        param.* = .{ .is_generic = false, .is_noalias = false, .type = field.type };
+    }
+    return @Type(.{ .@"fn" = .{
+        .calling_convention = .c,
+        .is_generic = false,
+        .is_var_args = false,
+        .return_type = Return,
+        .params = &params,
+    } });
+}
+
+/// A C function for `invoke` that passes the block and its arguments, as
+/// a tuple, to `forward`. Zig cannot declare a function's parameters from a
+/// list of types, hence one case per arity.
+fn trampoline(
+    comptime Literal: type,
+    comptime R: type,
+    comptime P: []const type,
+    comptime forward: anytype,
+) *const fn () callconv(.c) void {
+    return switch (P.len) {
+        0 => @ptrCast(&struct {
+            fn f(b: *Literal) callconv(.c) R {
+                return forward(b, .{});
+            }
+        }.f),
+        1 => @ptrCast(&struct {
+            fn f(b: *Literal, a0: P[0]) callconv(.c) R {
+                return forward(b, .{a0});
+            }
+        }.f),
+        2 => @ptrCast(&struct {
+            fn f(b: *Literal, a0: P[0], a1: P[1]) callconv(.c) R {
+                return forward(b, .{ a0, a1 });
+            }
+        }.f),
+        3 => @ptrCast(&struct {
+            fn f(b: *Literal, a0: P[0], a1: P[1], a2: P[2]) callconv(.c) R {
+                return forward(b, .{ a0, a1, a2 });
+            }
+        }.f),
+        4 => @ptrCast(&struct {
+            fn f(b: *Literal, a0: P[0], a1: P[1], a2: P[2], a3: P[3]) callconv(.c) R {
+                return forward(b, .{ a0, a1, a2, a3 });
+            }
+        }.f),
+        5 => @ptrCast(&struct {
+            fn f(b: *Literal, a0: P[0], a1: P[1], a2: P[2], a3: P[3], a4: P[4]) callconv(.c) R {
+                return forward(b, .{ a0, a1, a2, a3, a4 });
+            }
+        }.f),
+        6 => @ptrCast(&struct {
+            fn f(b: *Literal, a0: P[0], a1: P[1], a2: P[2], a3: P[3], a4: P[4], a5: P[5]) callconv(.c) R {
+                return forward(b, .{ a0, a1, a2, a3, a4, a5 });
+            }
+        }.f),
+        else => @compileError("blocks with more than 6 arguments are not supported"),
+    };
+}
+
+fn paramTypes(comptime params: []const std.builtin.Type.Fn.Param) []const type {
+    var types: [params.len]type = undefined;
+    for (params, &types) |param, *t| t.* = param.type.?;
+    const final = types;
+    return &final;
+}
+
+/// The end of the last field of `Context`, without the padding that
+/// rounds its size up to its alignment.
+fn capturesSize(comptime Context: type) usize {
+    if (@typeInfo(Context) != .@"struct") return @sizeOf(Context);
+    var end: usize = 0;
+    for (@typeInfo(Context).@"struct".fields) |field| {
+        if (field.is_comptime) continue;
+        end = @max(end, @offsetOf(Context, field.name) + @sizeOf(field.type));
+    }
+    return end;
+}
+
+/// The names of the fields of `Context` that hold objects.
+fn objectFields(comptime Context: type) []const []const u8 {
+    if (@typeInfo(Context) != .@"struct") return &.{};
+    var names: []const []const u8 = &.{};
+    for (@typeInfo(Context).@"struct".fields) |field| {
+        if (field.type == objc.id or field.type == ?objc.id) names = names ++ &[_][]const u8{field.name};
+    }
+    return names;
+}
+
+/// The Objective-C type encoding of a block type, as clang writes it into
+/// the descriptor: the result, the size of the arguments, then each
+/// argument with its offset, starting with the block itself (`@?`).
+/// Arguments take at least the size of an `int`.
+fn signature(comptime Return: type, comptime params: []const type) [:0]const u8 {
+    var args: []const u8 = "@?0";
+    var offset: usize = @sizeOf(*anyopaque);
+    for (params) |P| {
+        args = args ++ encoding(P) ++ std.fmt.comptimePrint("{d}", .{offset});
+        offset += @max(@sizeOf(P), @sizeOf(c_int));
+    }
+    return std.fmt.comptimePrint("{s}{d}{s}", .{ encoding(Return), offset, args });
+}
+
+/// The type encoding of `T` (`@encode`). Structures are encoded without
+/// their C name (`{?=dd}`), and pointers to anything but a C scalar as
+/// `^v`, which libobjc sizes the same.
+fn encoding(comptime T: type) []const u8 {
+    if (T == objc.id or T == ?objc.id) return "@";
+    if (T == objc.Class or T == ?objc.Class) return "#";
+    if (T == objc.SEL or T == ?objc.SEL) return ":";
+    if (T == c_longdouble) return "D";
+    return switch (@typeInfo(T)) {
+        .void => "v",
+        .bool => "B",
+        .int => |int| switch (int.bits) {
+            8 => if (int.signedness == .signed) "c" else "C",
+            16 => if (int.signedness == .signed) "s" else "S",
+            32 => if (int.signedness == .signed) "i" else "I",
+            64 => if (int.signedness == .signed) "q" else "Q",
+            else => @compileError("no type encoding for " ++ @typeName(T)),
+        },
+        .float => |float| switch (float.bits) {
+            32 => "f",
+            64 => "d",
+            else => @compileError("no type encoding for " ++ @typeName(T)),
+        },
+        .@"enum" => |e| encoding(e.tag_type),
+        .optional => |optional| encoding(optional.child),
+        .pointer => |pointer| if (pointer.size == .slice)
+            @compileError("no type encoding for " ++ @typeName(T))
+        else
+            (if (pointer.is_const) "r" else "") ++ switch (@typeInfo(pointer.child)) {
+                .int => |int| if (int.bits == 8 and pointer.size != .one) "*" else "^" ++ encoding(pointer.child),
+                .bool, .float => "^" ++ encoding(pointer.child),
+                else => "^v",
+            },
+        .@"struct" => |s| if (s.layout == .@"extern") blk: {
+            var fields: []const u8 = "";
+            for (s.fields) |field| fields = fields ++ encoding(field.type);
+            break :blk "{?=" ++ fields ++ "}";
+        } else @compileError("no type encoding for " ++ @typeName(T)),
+        else => @compileError("no type encoding for " ++ @typeName(T)),
+    };
+}
+
+// <Block.h>, in libSystem.
+extern fn _Block_copy(block: ?*const anyopaque) ?*anyopaque;
+extern fn _Block_release(block: ?*const anyopaque) void;
+extern fn _Block_object_assign(dst: *anyopaque, object: ?*const anyopaque, flags: c_int) void;
+extern fn _Block_object_dispose(object: ?*const anyopaque, flags: c_int) void;
+extern var _NSConcreteGlobalBlock: [32]?*anyopaque;
+extern var _NSConcreteStackBlock: [32]?*anyopaque;
+
+// The layouts of libclosure's Block_private.h and clang's CGBlocks for
+// 64-bit targets, checked for whichever target compiles this module.
+comptime {
+    const assert = std.debug.assert;
+    assert(@sizeOf(Header) == 32);
+    assert(@offsetOf(Header, "flags") == 8);
+    assert(@offsetOf(Header, "invoke") == 16);
+    assert(@offsetOf(Header, "descriptor") == 24);
+    assert(@offsetOf(Descriptor(false), "size") == 8);
+    assert(@offsetOf(Descriptor(false), "signature") == 16);
+    assert(@sizeOf(Descriptor(false)) == 32);
+    assert(@offsetOf(Descriptor(true), "copy") == 16);
+    assert(@offsetOf(Descriptor(true), "dispose") == 24);
+    assert(@offsetOf(Descriptor(true), "signature") == 32);
+    assert(@sizeOf(Descriptor(true)) == 48);
+
+    const eql = std.mem.eql;
+    // void (^)(void) and void (^)(id<MTLCommandBuffer>), as clang encodes
+    // them, and CVDisplayLinkSetOutputHandler's block, whose structure
+    // pointers clang would spell out.
+    assert(eql(u8, signature(void, &.{}), "v8@?0"));
+    assert(eql(u8, signature(void, &.{objc.id}), "v16@?0@8"));
+    assert(eql(u8, signature(i32, &.{ *anyopaque, *const anyopaque, *const anyopaque, u64, *u64 }), "i48@?0^v8r^v16r^v24Q32^Q40"));
+    assert(eql(u8, signature(bool, &.{ u8, f64 }), "B20@?0C8d12"));
+
+    const Capture = struct { device: objc.id, count: u32 };
+    const Block = Stack(Capture, struct {
+        fn invoke(_: *Capture, _: objc.id) void {}
+    }.invoke);
+    assert(@offsetOf(Block, "context") == @sizeOf(Header));
+    assert(@sizeOf(Block) == @sizeOf(Header) + @sizeOf(Capture));
+    assert(objectFields(Capture).len == 1 and eql(u8, objectFields(Capture)[0], "device"));
+    // A block capturing `id device` and `unsigned count` is 44 bytes.
+    assert(capturesSize(extern struct { device: objc.id, count: u32 }) == 12);
+}
+
+test "signature encodes the result, the arguments' size and each offset" {
+    try std.testing.expectEqualStrings("v8@?0", comptime signature(void, &.{}));
+    try std.testing.expectEqualStrings("v16@?0@8", comptime signature(void, &.{objc.id}));
+    // Arguments smaller than an int still take four bytes.
+    try std.testing.expectEqualStrings("v16@?0c8s12", comptime signature(void, &.{ i8, i16 }));
+    try std.testing.expectEqualStrings(
+        "{?=dddd}24@?0d8d16",
+        comptime signature(extern struct { x: f64, y: f64, w: f64, h: f64 }, &.{ f64, f64 }),
+    );
+}
+
+test "encoding matches @encode" {
+    const expect = std.testing.expectEqualStrings;
+    try expect("r*", comptime encoding([*:0]const u8));
+    try expect("^d", comptime encoding(*f64));
+    try expect("^v", comptime encoding(?*anyopaque));
+    try expect("#", comptime encoding(objc.Class));
+    try expect(":", comptime encoding(objc.SEL));
+    try expect("B", comptime encoding(bool));
+    try expect("q", comptime encoding(c_long));
+    try expect("I", comptime encoding(enum(u32) { a, b }));
+    try expect("{?=dd}", comptime encoding(extern struct { x: f64, y: f64 }));
+}
+
+test "blockFlags sets BLOCK_USE_STRET for large results on x86_64 only" {
+    const Rect = extern struct { x: f64, y: f64, w: f64, h: f64 };
+    const Point = extern struct { x: f64, y: f64 };
+    const stret: c_int = if (builtin.cpu.arch == .x86_64) BLOCK_USE_STRET else 0;
+    try std.testing.expectEqual(BLOCK_HAS_SIGNATURE | stret, blockFlags(Rect));
+    try std.testing.expectEqual(BLOCK_HAS_SIGNATURE, blockFlags(Point));
+    try std.testing.expectEqual(BLOCK_HAS_SIGNATURE, blockFlags(void));
+}
+
+test "the descriptor of a stack block ends at the last capture" {
+    const Frame = extern struct { device: objc.id, count: u32 };
+    try std.testing.expectEqual(12, comptime capturesSize(Frame));
+    try std.testing.expectEqual(1, (comptime objectFields(Frame)).len);
+
+    // No objects, so no copy and dispose helpers.
+    const Counter = struct { count: *u64 };
+    const Block = Stack(Counter, struct {
+        fn invoke(_: *Counter) void {}
+    }.invoke);
+    try std.testing.expectEqual(@sizeOf(Header) + 8, Block.descriptor.size);
+    try std.testing.expectEqualStrings("v8@?0", std.mem.span(Block.descriptor.signature));
+}
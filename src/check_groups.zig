@@ -0,0 +1,211 @@
+//! Checks that `addGroups` cannot miss headers: every framework in the SDK
+//! must be in a group, and the headers of each group may only include
+//! groups in its dependency closure or in the closure of the core's
+//! dependencies, which `addGroups` always adds. So must the headers of
+//! the core, the part of `include/` in no group.
+//!
+//! Usage: check_groups <sdk-dir> <core-dep>,... <name>:<path>:<dep>,...
+//!
+//! An include `<X/...>` or `"X/..."` is of the group of
+//! `Frameworks/X.framework` or `include/X`. Conditions around includes
+//! are not evaluated, so a group must depend on everything it may include.
+const std = @import("std");
+
+const Group = struct {
+    name: []const u8,
+    path: []const u8,
+    deps: []const []const u8,
+};
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3) {
+        std.log.err("usage: {s} <sdk-dir> <core-dep>,... <name>:<path>:<dep>,...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var groups = std.ArrayList(Group).init(arena);
+    for (args[3..]) |arg| {
+        var fields = std.mem.splitScalar(u8, arg, ':');
+        const name = fields.next().?;
+        const path = fields.next() orelse {
+            std.log.err("{s}: expected <name>:<path>:<dep>,...", .{arg});
+            std.process.exit(1);
+        };
+        try groups.append(.{ .name = name, .path = path, .deps = try list(arena, fields.rest()) });
+    }
+
+    // The group each include directory belongs to.
+    var owners: std.StringHashMapUnmanaged(usize) = .{};
+    for (groups.items, 0..) |g, i| {
+        const base = std.fs.path.basename(g.path);
+        const dir = if (std.mem.startsWith(u8, g.path, "Frameworks/"))
+            base[0 .. base.len - ".framework".len]
+        else
+            base;
+        try owners.put(arena, dir, i);
+    }
+
+    var sdk = try std.fs.cwd().openDir(args[1], .{});
+    defer sdk.close();
+    var failed = false;
+
+    var frameworks = try sdk.openDir("Frameworks", .{ .iterate = true });
+    defer frameworks.close();
+    var it = frameworks.iterate();
+    while (try it.next()) |entry| {
+        if (!std.mem.endsWith(u8, entry.name, ".framework")) continue;
+        if (owners.get(entry.name[0 .. entry.name.len - ".framework".len]) == null) {
+            std.log.err("Frameworks/{s} is in no group", .{entry.name});
+            failed = true;
+        }
+    }
+
+    const core = try closure(arena, groups.items, try list(arena, args[2]));
+    for (groups.items) |g| {
+        const allowed = try closure(arena, groups.items, &.{g.name});
+        for (allowed, core) |*a, c| a.* = a.* or c;
+        var dir = try sdk.openDir(g.path, .{ .iterate = true });
+        defer dir.close();
+        if (try check(arena, groups.items, owners, allowed, g.name, g.path, dir)) failed = true;
+    }
+
+    // The core: what is in `include/` and in no group.
+    var include = try sdk.openDir("include", .{ .iterate = true });
+    defer include.close();
+    it = include.iterate();
+    while (try it.next()) |entry| {
+        const path = try std.fs.path.join(arena, &.{ "include", entry.name });
+        const grouped = for (groups.items) |g| {
+            if (std.mem.eql(u8, g.path, path)) break true;
+        } else false;
+        if (grouped) continue;
+        switch (entry.kind) {
+            .directory => {
+                var dir = try include.openDir(entry.name, .{ .iterate = true });
+                defer dir.close();
+                if (try check(arena, groups.items, owners, core, "core", path, dir)) failed = true;
+            },
+            .file => {
+                const text = try include.readFileAlloc(arena, entry.name, std.math.maxInt(u32));
+                if (try checkFile(groups.items, owners, core, "core", path, text)) failed = true;
+            },
+            else => {},
+        }
+    }
+    if (failed) std.process.exit(1);
+}
+
+/// Checks the headers under `dir`. Symlinks are not followed: in a
+/// framework they lead to `Versions/A`, which is walked itself.
+fn check(
+    arena: std.mem.Allocator,
+    groups: []const Group,
+    owners: std.StringHashMapUnmanaged(usize),
+    allowed: []const bool,
+    name: []const u8,
+    path: []const u8,
+    dir: std.fs.Dir,
+) !bool {
+    var failed = false;
+    var walker = try dir.walk(arena);
+    defer walker.deinit();
+    while (try walker.next()) |entry| {
+        if (entry.kind != .file) continue;
+        const text = try entry.dir.readFileAlloc(arena, entry.basename, std.math.maxInt(u32));
+        const file = try std.fs.path.join(arena, &.{ path, entry.path });
+        if (try checkFile(groups, owners, allowed, name, file, text)) failed = true;
+    }
+    return failed;
+}
+
+fn checkFile(
+    groups: []const Group,
+    owners: std.StringHashMapUnmanaged(usize),
+    allowed: []const bool,
+    name: []const u8,
+    path: []const u8,
+    text: []const u8,
+) !bool {
+    var failed = false;
+    var lines = std.mem.splitScalar(u8, text, '\n');
+    while (lines.next()) |line| {
+        const dir = includedDir(line) orelse continue;
+        const owner = owners.get(dir) orelse continue;
+        if (allowed[owner]) continue;
+        std.log.err("{s}: {s} includes {s}/ but {s} does not depend on {s}", .{
+            name,
+            path,
+            dir,
+            name,
+            groups[owner].name,
+        });
+        failed = true;
+    }
+    return failed;
+}
+
+/// The first path component of the header of an `#include`, `#import` or
+/// `#include_next` with `<...>` or `"..."`, allowing spaces around the `#`.
+fn includedDir(line: []const u8) ?[]const u8 {
+    var rest = std.mem.trimLeft(u8, line, " \t");
+    if (!std.mem.startsWith(u8, rest, "#")) return null;
+    rest = std.mem.trimLeft(u8, rest[1..], " \t");
+    for ([_][]const u8{ "include_next", "include", "import" }) |keyword| {
+        if (std.mem.startsWith(u8, rest, keyword)) {
+            rest = std.mem.trimLeft(u8, rest[keyword.len..], " \t");
+            break;
+        }
+    } else return null;
+    if (rest.len == 0) return null;
+    const close: u8 = switch (rest[0]) {
+        '<' => '>',
+        '"' => '"',
+        else => return null,
+    };
+    const end = std.mem.indexOfScalarPos(u8, rest, 1, close) orelse return null;
+    const slash = std.mem.indexOfScalar(u8, rest[1..end], '/') orelse return null;
+    return rest[1..][0..slash];
+}
+
+/// Which of `groups` are in the closure of `names`, as `groupClosure` in
+/// build.zig computes it.
+fn closure(arena: std.mem.Allocator, groups: []const Group, names: []const []const u8) ![]bool {
+    const wanted = try arena.alloc(bool, groups.len);
+    @memset(wanted, false);
+    var stack = std.ArrayList([]const u8).init(arena);
+    try stack.appendSlice(names);
+    while (stack.pop()) |name| {
+        const idx = for (groups, 0..) |g, i| {
+            if (std.mem.eql(u8, g.name, name)) break i;
+        } else {
+            std.log.err("unknown group {s}", .{name});
+            std.process.exit(1);
+        };
+        if (wanted[idx]) continue;
+        wanted[idx] = true;
+        try stack.appendSlice(groups[idx].deps);
+    }
+    return wanted;
+}
+
+/// The items of a comma-separated list.
+fn list(arena: std.mem.Allocator, text: []const u8) ![]const []const u8 {
+    var items = std.ArrayList([]const u8).init(arena);
+    var it = std.mem.tokenizeScalar(u8, text, ',');
+    while (it.next()) |item| try items.append(item);
+    return items.items;
+}
+
+test "includedDir" {
+    try std.testing.expectEqualStrings("CoreFoundation", includedDir("#include <CoreFoundation/CFBase.h>").?);
+    try std.testing.expectEqualStrings("mach", includedDir("  #  import \"mach/mach.h\"").?);
+    try std.testing.expectEqualStrings("libxml", includedDir("#include_next <libxml/tree.h>").?);
+    try std.testing.expect(includedDir("#include <stdint.h>") == null);
+    try std.testing.expect(includedDir("#define X <Foo/Bar.h>") == null);
+    try std.testing.expect(includedDir("#include MACRO") == null);
+}
@@ -0,0 +1,169 @@
+//! Stores the files of the SDK by content and reports the bytes spent on
+//! duplicates, e.g. the headers Kernel.framework shares with `include/`.
+//!
+//! Usage: dedup <out-dir> <root> <dir>...
+//!
+//! Writes to `<out-dir>`:
+//! - `objects/<sha256>`: one file per distinct content, hard linked (or
+//!   copied) from the first file that has it.
+//! - `manifest.txt`: `file\t<sha256>\t<path>` or `link\t<target>\t<path>`
+//!   for each file and symlink under the dirs, by path relative to
+//!   `<root>`. `materialize` turns a store back into the tree.
+//! - `report.json`: totals and every group of identical files, largest
+//!   waste first.
+const std = @import("std");
+const builtin = @import("builtin");
+
+const Sha256 = std.crypto.hash.sha2.Sha256;
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 4) {
+        std.log.err("usage: {s} <out-dir> <root> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+    var objects = try out.makeOpenPath("objects", .{});
+    defer objects.close();
+    var root = try std.fs.cwd().openDir(args[2], .{});
+    defer root.close();
+
+    const Entry = struct {
+        path: []const u8,
+        /// The hash of a file or the target of a symlink.
+        value: []const u8,
+        link: bool,
+    };
+    var entries = std.ArrayList(Entry).init(arena);
+    var groups: std.StringArrayHashMapUnmanaged(Group) = .{};
+
+    for (args[3..]) |name| {
+        var dir = try root.openDir(name, .{ .iterate = true });
+        defer dir.close();
+        var walker = try dir.walk(arena);
+        defer walker.deinit();
+        while (try walker.next()) |entry| {
+            const path = try std.fs.path.join(arena, &.{ name, entry.path });
+            std.mem.replaceScalar(u8, path, std.fs.path.sep, '/');
+            switch (entry.kind) {
+                .sym_link => {
+                    var buf: [std.fs.max_path_bytes]u8 = undefined;
+                    const target = try arena.dupe(u8, try dir.readLink(entry.path, &buf));
+                    try entries.append(.{ .path = path, .value = target, .link = true });
+                },
+                .file => {
+                    const data = try dir.readFileAlloc(arena, entry.path, std.math.maxInt(u32));
+                    var digest: [Sha256.digest_length]u8 = undefined;
+                    Sha256.hash(data, &digest, .{});
+                    const hash = try std.fmt.allocPrint(arena, "{s}", .{std.fmt.fmtSliceHexLower(&digest)});
+                    try entries.append(.{ .path = path, .value = hash, .link = false });
+
+                    const group = try groups.getOrPut(arena, hash);
+                    if (!group.found_existing) {
+                        group.value_ptr.* = .{ .bytes = data.len };
+                        try link(try std.fs.path.join(arena, &.{ args[2], path }), objects, hash);
+                    }
+                    try group.value_ptr.paths.append(arena, path);
+                },
+                else => {},
+            }
+        }
+    }
+
+    std.mem.sort(Entry, entries.items, {}, struct {
+        fn lessThan(_: void, a: Entry, b: Entry) bool {
+            return std.mem.lessThan(u8, a.path, b.path);
+        }
+    }.lessThan);
+    {
+        const file = try out.createFile("manifest.txt", .{});
+        defer file.close();
+        var buf = std.io.bufferedWriter(file.writer());
+        for (entries.items) |entry| {
+            try buf.writer().print("{s}\t{s}\t{s}\n", .{ if (entry.link) "link" else "file", entry.value, entry.path });
+        }
+        try buf.flush();
+    }
+
+    try writeReport(arena, out, groups);
+}
+
+const Group = struct {
+    bytes: usize,
+    paths: std.ArrayListUnmanaged([]const u8) = .{},
+};
+
+fn writeReport(arena: std.mem.Allocator, out: std.fs.Dir, groups: std.StringArrayHashMapUnmanaged(Group)) !void {
+    const Duplicate = struct {
+        sha256: []const u8,
+        bytes: usize,
+        /// The bytes of every copy but one.
+        wasted_bytes: usize,
+        paths: []const []const u8,
+    };
+    var report: struct {
+        files: usize = 0,
+        bytes: usize = 0,
+        unique_files: usize = 0,
+        unique_bytes: usize = 0,
+        duplicate_files: usize = 0,
+        duplicate_bytes: usize = 0,
+        duplicates: []const Duplicate = &.{},
+    } = .{};
+
+    var duplicates = std.ArrayList(Duplicate).init(arena);
+    for (groups.keys(), groups.values()) |hash, group| {
+        const copies = group.paths.items.len;
+        report.files += copies;
+        report.bytes += group.bytes * copies;
+        report.unique_files += 1;
+        report.unique_bytes += group.bytes;
+        if (copies == 1) continue;
+        report.duplicate_files += copies - 1;
+        report.duplicate_bytes += group.bytes * (copies - 1);
+        std.mem.sort([]const u8, group.paths.items, {}, struct {
+            fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+                return std.mem.lessThan(u8, a, b);
+            }
+        }.lessThan);
+        try duplicates.append(.{
+            .sha256 = hash,
+            .bytes = group.bytes,
+            .wasted_bytes = group.bytes * (copies - 1),
+            .paths = group.paths.items,
+        });
+    }
+    std.mem.sort(Duplicate, duplicates.items, {}, struct {
+        fn lessThan(_: void, a: Duplicate, b: Duplicate) bool {
+            return a.wasted_bytes > b.wasted_bytes;
+        }
+    }.lessThan);
+    report.duplicates = duplicates.items;
+
+    const file = try out.createFile("report.json", .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    try std.json.stringify(report, .{ .whitespace = .indent_2 }, buf.writer());
+    try buf.writer().writeByte('\n');
+    try buf.flush();
+}
+
+fn link(path: []const u8, dst: std.fs.Dir, name: []const u8) !void {
+    if (builtin.os.tag == .windows) {
+        try std.fs.cwd().copyFile(path, dst, name, .{});
+    } else {
+        std.posix.linkat(std.posix.AT.FDCWD, path, dst.fd, name, 0) catch |err| switch (err) {
+            error.PathAlreadyExists => {},
+            error.NotSameFileSystem, error.LinkQuotaExceeded, error.AccessDenied => {
+                try std.fs.cwd().copyFile(path, dst, name, .{});
+            },
+            else => return err,
+        };
+    }
+}
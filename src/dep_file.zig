@@ -0,0 +1,49 @@
+//! Writes the depfile of a tool that reads the SDK through directory
+//! arguments. The zig cache keys a directory argument by its path alone,
+//! so such a run lists every file it reads in a depfile given with
+//! `Run.addDepFileOutputArg`, and the cache then keys the run on their
+//! contents too. A file added to a directory is only noticed once a file
+//! already listed changes as well.
+const std = @import("std");
+
+pub const DepFile = struct {
+    arena: std.mem.Allocator,
+    paths: std.ArrayListUnmanaged([]const u8) = .{},
+
+    pub fn init(arena: std.mem.Allocator) DepFile {
+        return .{ .arena = arena };
+    }
+
+    /// Records a file the tool read, by its path relative to the working
+    /// directory or absolute.
+    pub fn add(self: *DepFile, path: []const u8) !void {
+        try self.paths.append(self.arena, try std.fs.path.resolve(self.arena, &.{path}));
+    }
+
+    /// Records `name` in `dir_path`.
+    pub fn addIn(self: *DepFile, dir_path: []const u8, name: []const u8) !void {
+        try self.paths.append(self.arena, try std.fs.path.resolve(self.arena, &.{ dir_path, name }));
+    }
+
+    /// Writes the make rule `inputs: <file>...`.
+    pub fn write(self: DepFile, path: []const u8) !void {
+        const file = try std.fs.cwd().createFile(path, .{});
+        defer file.close();
+        var buf = std.io.bufferedWriter(file.writer());
+        const w = buf.writer();
+        try w.writeAll("inputs:");
+        for (self.paths.items) |input| {
+            try w.writeAll(" \\\n  ");
+            for (input) |c| {
+                switch (c) {
+                    ' ', '#', '\\' => try w.writeByte('\\'),
+                    '$' => try w.writeByte('$'),
+                    else => {},
+                }
+                try w.writeByte(c);
+            }
+        }
+        try w.writeByte('\n');
+        try buf.flush();
+    }
+};
@@ -0,0 +1,147 @@
+//! Builds a view of the SDK without symlinks or framework bundles: the
+//! headers of every framework under `include/<Framework>/`, next to the
+//! contents of the SDK's `include/`, and every stub under `lib/`. Headers
+//! are then found with plain `-I` lookups, and nothing in the view needs
+//! the file system or the cache to keep symlinks.
+//!
+//! Files are hard links to the originals, or copies where hard links are
+//! not possible (across file systems, on Windows).
+//!
+//! Usage: flat_view <out-dir> <include-dir> <frameworks-dir> <lib-dir> [framework...]
+//!
+//! With no frameworks given, every framework in the directory is included.
+//! Framework stubs go to `lib/<Framework>.framework/<Framework>.tbd` so that
+//! `-framework` finds them with `lib/` as the framework search path.
+const std = @import("std");
+const builtin = @import("builtin");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 5) {
+        std.log.err("usage: {s} <out-dir> <include-dir> <frameworks-dir> <lib-dir> [framework...]", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+    var view: View = .{
+        .arena = arena,
+        .include = try out.makeOpenPath("include", .{}),
+        .lib = try out.makeOpenPath("lib", .{}),
+    };
+
+    const frameworks = try std.fs.cwd().realpathAlloc(arena, args[3]);
+    if (args.len > 5) {
+        for (args[5..]) |name| try view.addFramework(frameworks, name);
+    } else {
+        var dir = try std.fs.openDirAbsolute(frameworks, .{ .iterate = true });
+        defer dir.close();
+        var it = dir.iterate();
+        while (try it.next()) |entry| {
+            if (!std.mem.endsWith(u8, entry.name, ".framework")) continue;
+            try view.addFramework(frameworks, entry.name[0 .. entry.name.len - ".framework".len]);
+        }
+    }
+
+    // Frameworks first, as in the header map, so that a framework never
+    // loses a file to a same-named directory under include/ (Security and
+    // security on a case-insensitive file system).
+    try view.addTree(view.include, try std.fs.cwd().realpathAlloc(arena, args[2]));
+    try view.addTree(view.lib, try std.fs.cwd().realpathAlloc(arena, args[4]));
+}
+
+const View = struct {
+    arena: std.mem.Allocator,
+    include: std.fs.Dir,
+    lib: std.fs.Dir,
+
+    /// Sub-frameworks can be reached through several umbrellas, e.g.
+    /// CoreText through ApplicationServices.
+    seen: std.StringHashMapUnmanaged(void) = .{},
+
+    /// Adds the framework's headers and stub, then those of its
+    /// sub-frameworks (e.g. CarbonCore inside CoreServices).
+    fn addFramework(self: *View, dir: []const u8, name: []const u8) !void {
+        if ((try self.seen.getOrPut(self.arena, try self.arena.dupe(u8, name))).found_existing) return;
+        const framework = try std.fmt.allocPrint(self.arena, "{s}/{s}.framework", .{ dir, name });
+
+        const headers_link = try std.fs.path.join(self.arena, &.{ framework, "Headers" });
+        if (std.fs.cwd().realpathAlloc(self.arena, headers_link)) |headers| {
+            var sub = try self.include.makeOpenPath(name, .{});
+            defer sub.close();
+            try self.addTree(sub, headers);
+        } else |err| switch (err) {
+            error.FileNotFound => {},
+            else => return err,
+        }
+
+        const stub_link = try std.fmt.allocPrint(self.arena, "{s}/{s}.tbd", .{ framework, name });
+        if (std.fs.cwd().realpathAlloc(self.arena, stub_link)) |stub| {
+            var sub = try self.lib.makeOpenPath(try std.fmt.allocPrint(self.arena, "{s}.framework", .{name}), .{});
+            defer sub.close();
+            try link(stub, sub, std.fs.path.basename(stub_link));
+        } else |err| switch (err) {
+            error.FileNotFound => {},
+            else => return err,
+        }
+
+        const subs = try std.fs.path.join(self.arena, &.{ framework, "Frameworks" });
+        var sub_dir = std.fs.openDirAbsolute(subs, .{ .iterate = true }) catch |err| switch (err) {
+            error.FileNotFound => return,
+            else => return err,
+        };
+        defer sub_dir.close();
+        var it = sub_dir.iterate();
+        while (try it.next()) |entry| {
+            if (!std.mem.endsWith(u8, entry.name, ".framework")) continue;
+            try self.addFramework(subs, entry.name[0 .. entry.name.len - ".framework".len]);
+        }
+    }
+
+    /// Links every file under `root` into `dst`. Symlinks are replaced by
+    /// what they point to.
+    fn addTree(self: *View, dst: std.fs.Dir, root: []const u8) !void {
+        var dir = try std.fs.openDirAbsolute(root, .{ .iterate = true });
+        defer dir.close();
+        var it = dir.iterate();
+        while (try it.next()) |entry| {
+            var path = try std.fs.path.join(self.arena, &.{ root, entry.name });
+            var kind = entry.kind;
+            if (kind == .sym_link) {
+                path = std.fs.cwd().realpathAlloc(self.arena, path) catch continue;
+                kind = (std.fs.cwd().statFile(path) catch continue).kind;
+                // A link to a parent would never end.
+                if (kind == .directory and std.mem.startsWith(u8, root, path)) continue;
+            }
+
+            switch (kind) {
+                .file => try link(path, dst, entry.name),
+                .directory => {
+                    var sub = try dst.makeOpenPath(entry.name, .{});
+                    defer sub.close();
+                    try self.addTree(sub, path);
+                },
+                else => {},
+            }
+        }
+    }
+};
+
+fn link(path: []const u8, dst: std.fs.Dir, name: []const u8) !void {
+    if (builtin.os.tag == .windows) {
+        try std.fs.cwd().copyFile(path, dst, name, .{});
+    } else {
+        std.posix.linkat(std.posix.AT.FDCWD, path, dst.fd, name, 0) catch |err| switch (err) {
+            // The first file wins, as on a search path.
+            error.PathAlreadyExists => {},
+            error.NotSameFileSystem, error.LinkQuotaExceeded, error.AccessDenied => {
+                try std.fs.cwd().copyFile(path, dst, name, .{});
+            },
+            else => return err,
+        };
+    }
+}
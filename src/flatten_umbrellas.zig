@@ -0,0 +1,207 @@
+//! Mirrors a `Frameworks/` directory with the stubs of umbrella frameworks
+//! flattened for one target. CoreServices, ApplicationServices, Carbon
+//! and a few others ship one stub with a document per sub-framework
+//! (CarbonCore, LaunchServices, HIToolbox, QD...) that the umbrella lists
+//! in `reexported-libraries`. The linker follows those re-exports for
+//! every symbol it looks up. A flattened stub is a single document that
+//! exports the sub-frameworks' symbols itself.
+//!
+//! Usage: flatten_umbrellas <out-dir> <out.d> <target> <frameworks-dir>
+//!
+//! The linker records the umbrella for a symbol that a re-exported
+//! library defines, unless that library has a public install name
+//! (`/usr/lib/libX.dylib` or a top-level framework in
+//! `/System/Library/Frameworks`) and can be linked directly. So only
+//! documents of the stub without a public install name are merged, and
+//! the flattened stub links the same binary. Public libraries, such as
+//! CoreFoundation for CoreServices, stay re-exported and their symbols
+//! are still attributed to them.
+//!
+//! Other frameworks link to their counterparts in `<frameworks-dir>`, as
+//! do the files and directories of a flattened framework besides its
+//! stub. The stubs read are listed in `<out.d>`.
+const std = @import("std");
+const tbd = @import("tbd");
+const DepFile = @import("dep_file").DepFile;
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 5) {
+        std.log.err("usage: {s} <out-dir> <out.d> <target> <frameworks-dir>", .{args[0]});
+        std.process.exit(1);
+    }
+    const target = args[3];
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+
+    var deps = DepFile.init(arena);
+    const frameworks = try std.fs.cwd().realpathAlloc(arena, args[4]);
+    var dir = try std.fs.openDirAbsolute(frameworks, .{ .iterate = true });
+    defer dir.close();
+    var it = dir.iterate();
+    while (try it.next()) |entry| {
+        const path = try std.fs.path.join(arena, &.{ frameworks, entry.name });
+        if (!std.mem.endsWith(u8, entry.name, ".framework")) {
+            try symLink(out, path, entry.name);
+            continue;
+        }
+        const name = entry.name[0 .. entry.name.len - ".framework".len];
+        const stub_name = try std.fmt.allocPrint(arena, "{s}.tbd", .{name});
+        const stub_path = try std.fs.path.join(arena, &.{ path, stub_name });
+        const text = std.fs.cwd().readFileAlloc(arena, stub_path, std.math.maxInt(u32)) catch |err| switch (err) {
+            error.FileNotFound => {
+                try symLink(out, path, entry.name);
+                continue;
+            },
+            else => return err,
+        };
+        try deps.add(stub_path);
+        const documents = tbd.parse(arena, text) catch |err| {
+            std.log.err("{s}: {s}", .{ stub_path, @errorName(err) });
+            std.process.exit(1);
+        };
+        const flat = try flatten(arena, documents, target) orelse {
+            try symLink(out, path, entry.name);
+            continue;
+        };
+
+        var framework = try out.makeOpenPath(entry.name, .{});
+        defer framework.close();
+        var bundle = try dir.openDir(entry.name, .{ .iterate = true });
+        defer bundle.close();
+        var files = bundle.iterate();
+        while (try files.next()) |file| {
+            if (std.mem.eql(u8, file.name, stub_name)) continue;
+            try symLink(framework, try std.fs.path.join(arena, &.{ path, file.name }), file.name);
+        }
+        var data = std.ArrayList(u8).init(arena);
+        try tbd.writeStub(&.{flat}, data.writer());
+        try framework.writeFile(.{ .sub_path = stub_name, .data = data.items });
+    }
+    try deps.write(args[2]);
+}
+
+fn symLink(dir: std.fs.Dir, target: []const u8, name: []const u8) !void {
+    dir.symLink(target, name, .{}) catch |err| switch (err) {
+        error.PathAlreadyExists => {},
+        else => return err,
+    };
+}
+
+/// The first document for `target` with the symbols of the documents it
+/// re-exports that have no public install name merged in, or null if it
+/// re-exports none.
+fn flatten(arena: std.mem.Allocator, documents: []const tbd.Document, target: []const u8) !?tbd.Document {
+    var inline_documents: std.StringHashMapUnmanaged(tbd.Document) = .{};
+    var umbrella: ?tbd.Document = null;
+    for (documents) |document| {
+        if (!contains(document.targets, target)) continue;
+        if (umbrella == null) {
+            umbrella = document;
+        } else try inline_documents.put(arena, document.install_name, document);
+    }
+    const root = umbrella orelse return null;
+
+    var exports: Merged = .{};
+    var reexports: Merged = .{};
+    try exports.add(arena, root.exports, target);
+    try reexports.add(arena, root.reexports, target);
+
+    var external: std.StringArrayHashMapUnmanaged(void) = .{};
+    var merged: std.StringHashMapUnmanaged(void) = .{};
+    var queue = std.ArrayList([]const u8).init(arena);
+    try queue.appendSlice(try libraries(arena, root, target));
+    var next: usize = 0;
+    while (next < queue.items.len) : (next += 1) {
+        const install_name = queue.items[next];
+        const document = inline_documents.get(install_name) orelse {
+            try external.put(arena, install_name, {});
+            continue;
+        };
+        if (isPublic(install_name)) {
+            try external.put(arena, install_name, {});
+            continue;
+        }
+        if ((try merged.getOrPut(arena, install_name)).found_existing) continue;
+        try exports.add(arena, document.exports, target);
+        try reexports.add(arena, document.reexports, target);
+        try queue.appendSlice(try libraries(arena, document, target));
+    }
+    if (merged.count() == 0) return null;
+
+    const targets = try arena.dupe([]const u8, &.{target});
+    var flat = root;
+    flat.targets = targets;
+    flat.parent_umbrella = &.{};
+    flat.allowable_clients = &.{};
+    flat.reexported_libraries = if (external.count() == 0) &.{} else try arena.dupe(tbd.Libraries, &.{
+        .{ .targets = targets, .libraries = external.keys() },
+    });
+    flat.exports = try exports.items(arena, targets);
+    flat.reexports = try reexports.items(arena, targets);
+    return flat;
+}
+
+/// Whether the linker links the library directly rather than through the
+/// library that re-exports it.
+fn isPublic(install_name: []const u8) bool {
+    if (tbd.frameworkName(install_name) != null) return true;
+    return std.mem.startsWith(u8, install_name, "/usr/lib/") and
+        std.mem.indexOfScalar(u8, install_name["/usr/lib/".len..], '/') == null;
+}
+
+/// The libraries `document` re-exports for `target`.
+fn libraries(arena: std.mem.Allocator, document: tbd.Document, target: []const u8) ![]const []const u8 {
+    var list = std.ArrayList([]const u8).init(arena);
+    for (document.reexported_libraries) |item| {
+        if (contains(item.targets, target)) try list.appendSlice(item.libraries);
+    }
+    return list.items;
+}
+
+/// The symbols of several `tbd.Symbols` lists for one target.
+const Merged = struct {
+    symbols: std.ArrayListUnmanaged([]const u8) = .{},
+    weak_symbols: std.ArrayListUnmanaged([]const u8) = .{},
+    objc_classes: std.ArrayListUnmanaged([]const u8) = .{},
+    objc_eh_types: std.ArrayListUnmanaged([]const u8) = .{},
+    objc_ivars: std.ArrayListUnmanaged([]const u8) = .{},
+
+    fn add(m: *Merged, arena: std.mem.Allocator, lists: []const tbd.Symbols, target: []const u8) !void {
+        for (lists) |list| {
+            if (!contains(list.targets, target)) continue;
+            try m.symbols.appendSlice(arena, list.symbols);
+            try m.weak_symbols.appendSlice(arena, list.weak_symbols);
+            try m.objc_classes.appendSlice(arena, list.objc_classes);
+            try m.objc_eh_types.appendSlice(arena, list.objc_eh_types);
+            try m.objc_ivars.appendSlice(arena, list.objc_ivars);
+        }
+    }
+
+    /// One item, or none if there are no symbols.
+    fn items(m: Merged, arena: std.mem.Allocator, targets: []const []const u8) ![]const tbd.Symbols {
+        const item: tbd.Symbols = .{
+            .targets = targets,
+            .symbols = m.symbols.items,
+            .weak_symbols = m.weak_symbols.items,
+            .objc_classes = m.objc_classes.items,
+            .objc_eh_types = m.objc_eh_types.items,
+            .objc_ivars = m.objc_ivars.items,
+        };
+        if (item.symbols.len + item.weak_symbols.len + item.objc_classes.len +
+            item.objc_eh_types.len + item.objc_ivars.len == 0) return &.{};
+        return arena.dupe(tbd.Symbols, &.{item});
+    }
+};
+
+fn contains(list: []const []const u8, item: []const u8) bool {
+    for (list) |x| {
+        if (std.mem.eql(u8, x, item)) return true;
+    }
+    return false;
+}
@@ -0,0 +1,182 @@
+//! Writes a clang header map (.hmap) that maps every `<Framework/Header.h>`
+//! and every header under `include/` straight to its file. Passed with
+//! `-I`, it resolves an include with one hash probe instead of a walk
+//! through the `-F`/`-isystem` directories and `Versions/Current` links.
+//!
+//! Usage: hmap <out.hmap> <include-dir> <frameworks-dir> [framework...]
+//!
+//! With no frameworks given, every framework in the directory is mapped.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 4) {
+        std.log.err("usage: {s} <out.hmap> <include-dir> <frameworks-dir> [framework...]", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var map: HeaderMap = .{ .arena = arena };
+
+    const frameworks = try std.fs.cwd().realpathAlloc(arena, args[3]);
+    if (args.len > 4) {
+        for (args[4..]) |name| try addFramework(&map, frameworks, name);
+    } else {
+        var dir = try std.fs.openDirAbsolute(frameworks, .{ .iterate = true });
+        defer dir.close();
+        var it = dir.iterate();
+        while (try it.next()) |entry| {
+            if (!std.mem.endsWith(u8, entry.name, ".framework")) continue;
+            try addFramework(&map, frameworks, entry.name[0 .. entry.name.len - ".framework".len]);
+        }
+    }
+
+    // Frameworks first so that a framework never loses a key to a
+    // same-named directory under include/.
+    try addTree(&map, try std.fs.cwd().realpathAlloc(arena, args[2]), "");
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    try map.write(buf.writer());
+    try buf.flush();
+}
+
+/// Maps `<name>/...` to the framework's headers, then does the same for
+/// its sub-frameworks (e.g. CarbonCore inside CoreServices).
+fn addFramework(map: *HeaderMap, dir: []const u8, name: []const u8) !void {
+    const framework = try std.fmt.allocPrint(map.arena, "{s}/{s}.framework", .{ dir, name });
+
+    const headers_link = try std.fs.path.join(map.arena, &.{ framework, "Headers" });
+    if (std.fs.cwd().realpathAlloc(map.arena, headers_link)) |headers| {
+        try addTree(map, headers, try std.fmt.allocPrint(map.arena, "{s}/", .{name}));
+    } else |err| switch (err) {
+        error.FileNotFound => {},
+        else => return err,
+    }
+
+    const subs = try std.fs.path.join(map.arena, &.{ framework, "Frameworks" });
+    var sub_dir = std.fs.openDirAbsolute(subs, .{ .iterate = true }) catch |err| switch (err) {
+        error.FileNotFound => return,
+        else => return err,
+    };
+    defer sub_dir.close();
+    var it = sub_dir.iterate();
+    while (try it.next()) |entry| {
+        if (!std.mem.endsWith(u8, entry.name, ".framework")) continue;
+        try addFramework(map, subs, entry.name[0 .. entry.name.len - ".framework".len]);
+    }
+}
+
+/// Maps `<key_prefix><relative path>` to every file under `root`.
+fn addTree(map: *HeaderMap, root: []const u8, key_prefix: []const u8) !void {
+    var dir = try std.fs.openDirAbsolute(root, .{ .iterate = true });
+    defer dir.close();
+    var walker = try dir.walk(map.arena);
+    defer walker.deinit();
+    while (try walker.next()) |entry| {
+        switch (entry.kind) {
+            .file => {},
+            // Symlinks to directories are reached through their targets.
+            .sym_link => {
+                const stat = dir.statFile(entry.path) catch continue;
+                if (stat.kind != .file) continue;
+            },
+            else => continue,
+        }
+
+        const key = try std.mem.concat(map.arena, u8, &.{ key_prefix, entry.path });
+        std.mem.replaceScalar(u8, key, std.fs.path.sep, '/');
+        try map.add(key, try std.fs.path.join(map.arena, &.{ root, entry.path }));
+    }
+}
+
+/// The on-disk format is clang's `HMapHeader` followed by a power of two
+/// `HMapBucket`s and a string table; see clang/Lex/HeaderMapTypes.h.
+const HeaderMap = struct {
+    arena: std.mem.Allocator,
+
+    /// Offset 0 is the empty bucket key, so no string may start there.
+    strings: std.ArrayListUnmanaged(u8) = .{},
+    interned: std.StringHashMapUnmanaged(u32) = .{},
+    entries: std.ArrayListUnmanaged(Bucket) = .{},
+
+    /// Lookups are case-insensitive, so are duplicate checks.
+    keys: std.StringHashMapUnmanaged(void) = .{},
+    max_value_len: u32 = 0,
+
+    const magic = 0x686d6170; // 'hmap'
+    const version = 1;
+    const header_size = 24;
+
+    const Bucket = struct {
+        key: u32 = 0,
+        prefix: u32 = 0,
+        suffix: u32 = 0,
+    };
+
+    fn add(self: *HeaderMap, key: []const u8, path: []const u8) !void {
+        const gop = try self.keys.getOrPut(self.arena, try std.ascii.allocLowerString(self.arena, key));
+        if (gop.found_existing) return;
+
+        const split = if (std.mem.lastIndexOfScalar(u8, path, std.fs.path.sep)) |i| i + 1 else 0;
+        try self.entries.append(self.arena, .{
+            .key = try self.intern(key),
+            .prefix = try self.intern(path[0..split]),
+            .suffix = try self.intern(path[split..]),
+        });
+        self.max_value_len = @max(self.max_value_len, @as(u32, @intCast(path.len)));
+    }
+
+    fn intern(self: *HeaderMap, s: []const u8) !u32 {
+        if (self.strings.items.len == 0) try self.strings.append(self.arena, 0);
+        const gop = try self.interned.getOrPut(self.arena, s);
+        if (!gop.found_existing) {
+            gop.value_ptr.* = @intCast(self.strings.items.len);
+            try self.strings.appendSlice(self.arena, s);
+            try self.strings.append(self.arena, 0);
+        }
+        return gop.value_ptr.*;
+    }
+
+    fn string(self: *const HeaderMap, offset: u32) []const u8 {
+        return std.mem.sliceTo(self.strings.items[offset..], 0);
+    }
+
+    fn write(self: *const HeaderMap, writer: anytype) !void {
+        // Keep the load factor at or below one half so probes stay short.
+        const count: u32 = @intCast(self.entries.items.len);
+        const num_buckets = try std.math.ceilPowerOfTwo(u32, @max(count * 2, 1));
+        const buckets = try self.arena.alloc(Bucket, num_buckets);
+        @memset(buckets, .{});
+        for (self.entries.items) |entry| {
+            var i = hash(self.string(entry.key)) & (num_buckets - 1);
+            while (buckets[i].key != 0) i = (i + 1) & (num_buckets - 1);
+            buckets[i] = entry;
+        }
+
+        try writer.writeInt(u32, magic, .little);
+        try writer.writeInt(u16, version, .little);
+        try writer.writeInt(u16, 0, .little);
+        try writer.writeInt(u32, header_size + num_buckets * 12, .little);
+        try writer.writeInt(u32, count, .little);
+        try writer.writeInt(u32, num_buckets, .little);
+        try writer.writeInt(u32, self.max_value_len, .little);
+        for (buckets) |bucket| {
+            try writer.writeInt(u32, bucket.key, .little);
+            try writer.writeInt(u32, bucket.prefix, .little);
+            try writer.writeInt(u32, bucket.suffix, .little);
+        }
+        try writer.writeAll(self.strings.items);
+    }
+
+    /// clang's HashHMapKey.
+    fn hash(key: []const u8) u32 {
+        var result: u32 = 0;
+        for (key) |c| result +%= @as(u32, std.ascii.toLower(c)) *% 13;
+        return result;
+    }
+};
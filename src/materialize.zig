@@ -0,0 +1,58 @@
+//! Rebuilds a tree from a store written by `dedup`. Identical files become
+//! hard links to one object, so each distinct header is on disk once.
+//!
+//! Usage: materialize <out-dir> <store-dir>
+const std = @import("std");
+const builtin = @import("builtin");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 3) {
+        std.log.err("usage: {s} <out-dir> <store-dir>", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+    const manifest = try std.fs.path.join(arena, &.{ args[2], "manifest.txt" });
+    const text = try std.fs.cwd().readFileAlloc(arena, manifest, std.math.maxInt(u32));
+
+    var lines = std.mem.tokenizeScalar(u8, text, '\n');
+    while (lines.next()) |line| {
+        var fields = std.mem.splitScalar(u8, line, '\t');
+        const kind = fields.next().?;
+        const value = fields.next() orelse return error.InvalidManifest;
+        const path = fields.rest();
+
+        var dir = try out.makeOpenPath(std.fs.path.dirnamePosix(path) orelse ".", .{});
+        defer dir.close();
+        const name = std.fs.path.basenamePosix(path);
+
+        if (std.mem.eql(u8, kind, "link")) {
+            dir.symLink(value, name, .{}) catch |err| switch (err) {
+                error.PathAlreadyExists => {},
+                else => return err,
+            };
+        } else if (std.mem.eql(u8, kind, "file")) {
+            try link(try std.fs.path.join(arena, &.{ args[2], "objects", value }), dir, name);
+        } else return error.InvalidManifest;
+    }
+}
+
+fn link(path: []const u8, dst: std.fs.Dir, name: []const u8) !void {
+    if (builtin.os.tag == .windows) {
+        try std.fs.cwd().copyFile(path, dst, name, .{});
+    } else {
+        std.posix.linkat(std.posix.AT.FDCWD, path, dst.fd, name, 0) catch |err| switch (err) {
+            error.PathAlreadyExists => {},
+            error.NotSameFileSystem, error.LinkQuotaExceeded, error.AccessDenied => {
+                try std.fs.cwd().copyFile(path, dst, name, .{});
+            },
+            else => return err,
+        };
+    }
+}
@@ -0,0 +1,200 @@
+//! Copies directories of `.tbd` stubs keeping only one target and the
+//! symbols a consumer references, so that relinking it parses a few KB of
+//! stubs instead of megabytes (Foundation.tbd alone is 1.3 MB).
+//!
+//! Usage: minimal_tbd <out-dir> <out.d> <target> <symbols.txt> <headers-dir> <dir>...
+//!
+//! `<symbols.txt>` lists one symbol per line, as `referenced_symbols`
+//! writes. Documents keep their install names, versions, umbrellas,
+//! allowable clients and re-exported libraries, so the linker resolves
+//! and records every kept symbol as it would against the full stub. A
+//! symbol missing from the list fails the link as undefined until the
+//! list is regenerated.
+//!
+//! The layout is mirrored as by `slim_tbd`: symlinks are copied and header
+//! and module directories link to their counterparts under
+//! `<headers-dir>/<basename>`. The stubs read are listed in `<out.d>`.
+const std = @import("std");
+const tbd = @import("tbd");
+const DepFile = @import("dep_file").DepFile;
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 7) {
+        std.log.err("usage: {s} <out-dir> <out.d> <target> <symbols.txt> <headers-dir> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var symbols: std.StringHashMapUnmanaged(void) = .{};
+    const text = try std.fs.cwd().readFileAlloc(arena, args[4], std.math.maxInt(u32));
+    var lines = std.mem.tokenizeAny(u8, text, "\r\n");
+    while (lines.next()) |line| try symbols.put(arena, line, {});
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+
+    const filter: Filter = .{ .arena = arena, .target = args[3], .symbols = &symbols };
+    const headers = try std.fs.cwd().realpathAlloc(arena, args[5]);
+    var deps = DepFile.init(arena);
+    for (args[6..]) |arg| {
+        const path = try std.fs.cwd().realpathAlloc(arena, arg);
+        const name = std.fs.path.basename(path);
+        var src = try std.fs.openDirAbsolute(path, .{ .iterate = true });
+        defer src.close();
+        var dst = try out.makeOpenPath(name, .{});
+        defer dst.close();
+        try mirror(arena, src, path, try std.fs.path.join(arena, &.{ headers, name }), dst, filter, &deps);
+    }
+    try deps.write(args[2]);
+}
+
+/// Directories that hold no stubs. They are linked instead of copied.
+const linked_dirs = [_][]const u8{ "Headers", "PrivateHeaders", "Modules", "Resources" };
+
+fn mirror(
+    arena: std.mem.Allocator,
+    src: std.fs.Dir,
+    src_path: []const u8,
+    /// Where `src` is in the headers dir.
+    headers_path: []const u8,
+    dst: std.fs.Dir,
+    filter: Filter,
+    deps: *DepFile,
+) !void {
+    var it = src.iterate();
+    while (try it.next()) |entry| switch (entry.kind) {
+        .directory => {
+            const path = try std.fs.path.join(arena, &.{ headers_path, entry.name });
+            for (linked_dirs) |name| {
+                if (std.mem.eql(u8, entry.name, name)) {
+                    try symLink(dst, path, entry.name);
+                    break;
+                }
+            } else {
+                var sub_src = try src.openDir(entry.name, .{ .iterate = true });
+                defer sub_src.close();
+                var sub_dst = try dst.makeOpenPath(entry.name, .{});
+                defer sub_dst.close();
+                const sub_src_path = try std.fs.path.join(arena, &.{ src_path, entry.name });
+                try mirror(arena, sub_src, sub_src_path, path, sub_dst, filter, deps);
+            }
+        },
+        .sym_link => {
+            var buf: [std.fs.max_path_bytes]u8 = undefined;
+            try symLink(dst, try src.readLink(entry.name, &buf), entry.name);
+        },
+        .file => {
+            if (!std.mem.endsWith(u8, entry.name, ".tbd")) continue;
+            const text = try src.readFileAlloc(arena, entry.name, std.math.maxInt(u32));
+            try deps.addIn(src_path, entry.name);
+            const documents = tbd.parse(arena, text) catch |err| {
+                std.log.err("{s}/{s}: {s}", .{ src_path, entry.name, @errorName(err) });
+                std.process.exit(1);
+            };
+            const kept = try filter.documents(documents);
+            if (kept.len == 0) continue;
+            var data = std.ArrayList(u8).init(arena);
+            try tbd.writeStub(kept, data.writer());
+            try dst.writeFile(.{ .sub_path = entry.name, .data = data.items });
+        },
+        else => {},
+    };
+}
+
+fn symLink(dir: std.fs.Dir, target: []const u8, name: []const u8) !void {
+    dir.symLink(target, name, .{}) catch |err| switch (err) {
+        error.PathAlreadyExists => {},
+        else => return err,
+    };
+}
+
+const Filter = struct {
+    arena: std.mem.Allocator,
+    target: []const u8,
+    symbols: *const std.StringHashMapUnmanaged(void),
+
+    /// The documents for the target, with every list narrowed to it and
+    /// exports to the referenced symbols.
+    fn documents(f: Filter, all: []const tbd.Document) ![]const tbd.Document {
+        var kept = std.ArrayList(tbd.Document).init(f.arena);
+        for (all) |document| {
+            if (!contains(document.targets, f.target)) continue;
+            var copy = document;
+            copy.targets = try f.arena.dupe([]const u8, &.{f.target});
+            copy.parent_umbrella = try f.items(tbd.Umbrella, document.parent_umbrella);
+            copy.allowable_clients = try f.items(tbd.Clients, document.allowable_clients);
+            copy.reexported_libraries = try f.items(tbd.Libraries, document.reexported_libraries);
+            copy.exports = try f.items(tbd.Symbols, document.exports);
+            copy.reexports = try f.items(tbd.Symbols, document.reexports);
+            try kept.append(copy);
+        }
+        return kept.items;
+    }
+
+    /// The items that apply to the target. Symbol lists are narrowed to
+    /// the referenced symbols and dropped if that leaves them empty.
+    fn items(f: Filter, comptime T: type, all: []const T) ![]const T {
+        var kept = std.ArrayList(T).init(f.arena);
+        for (all) |item| {
+            if (!contains(item.targets, f.target)) continue;
+            var copy = item;
+            copy.targets = try f.arena.dupe([]const u8, &.{f.target});
+            if (T == tbd.Symbols) {
+                copy.symbols = try f.names(item.symbols, "");
+                copy.weak_symbols = try f.names(item.weak_symbols, "");
+                copy.objc_classes = try f.classes(item.objc_classes);
+                copy.objc_eh_types = try f.names(item.objc_eh_types, "_OBJC_EHTYPE_$_");
+                copy.objc_ivars = try f.names(item.objc_ivars, "_OBJC_IVAR_$_");
+                if (copy.symbols.len + copy.weak_symbols.len + copy.objc_classes.len +
+                    copy.objc_eh_types.len + copy.objc_ivars.len == 0) continue;
+            }
+            try kept.append(copy);
+        }
+        return kept.items;
+    }
+
+    /// The names whose symbol (`prefix` then the name) is referenced.
+    /// Linker directives such as `$ld$hide$os10.4$_foo` are kept if the
+    /// symbol they apply to is.
+    fn names(f: Filter, all: []const []const u8, comptime prefix: []const u8) ![]const []const u8 {
+        var kept = std.ArrayList([]const u8).init(f.arena);
+        for (all) |name| {
+            const symbol = try std.fmt.allocPrint(f.arena, prefix ++ "{s}", .{directiveSymbol(name)});
+            if (f.symbols.contains(symbol)) try kept.append(name);
+        }
+        return kept.items;
+    }
+
+    /// A class defines both `_OBJC_CLASS_$_` and `_OBJC_METACLASS_$_`.
+    fn classes(f: Filter, all: []const []const u8) ![]const []const u8 {
+        var kept = std.ArrayList([]const u8).init(f.arena);
+        for (all) |name| {
+            const class = try std.fmt.allocPrint(f.arena, "_OBJC_CLASS_$_{s}", .{name});
+            const metaclass = try std.fmt.allocPrint(f.arena, "_OBJC_METACLASS_$_{s}", .{name});
+            if (f.symbols.contains(class) or f.symbols.contains(metaclass)) try kept.append(name);
+        }
+        return kept.items;
+    }
+};
+
+/// `_foo` for `$ld$<action>$<condition>$_foo`, otherwise the name itself.
+fn directiveSymbol(name: []const u8) []const u8 {
+    if (!std.mem.startsWith(u8, name, "$ld$")) return name;
+    var rest = name["$ld$".len..];
+    for (0..2) |_| {
+        const dollar = std.mem.indexOfScalar(u8, rest, '$') orelse return name;
+        rest = rest[dollar + 1 ..];
+    }
+    return rest;
+}
+
+fn contains(list: []const []const u8, item: []const u8) bool {
+    for (list) |x| {
+        if (std.mem.eql(u8, x, item)) return true;
+    }
+    return false;
+}
@@ -0,0 +1,109 @@
+//! Lists the frameworks and libraries that Mach-O objects need, going by
+//! the symbols they leave undefined and the symbol index of the SDK's
+//! stubs (`tbd_index`). Linking only these rather than a conservative set
+//! (Cocoa, Carbon...) saves the linker parsing the other stubs and dyld
+//! loading the other images at launch.
+//!
+//! Usage: needed_libraries <out.txt> <index.tbdi> <libSystem.tbd> <target> <object-or-archive>...
+//!
+//! `<target>` is a stub target such as `arm64-macos`. Symbols defined by
+//! one of the given objects or exported by `<libSystem.tbd>`, the stub zig
+//! always links, are not looked up. Some frameworks re-export libSystem
+//! symbols (CoreServices re-exports part of libm), which would otherwise
+//! pull them in. A symbol that a sub-framework or private framework
+//! exports is attributed to the public framework that re-exports it, e.g.
+//! CoreServices for CarbonCore.
+//!
+//! Writes one `framework <name>` or `library <name>` line per library,
+//! sorted, after comment lines that count the symbols found in no stub.
+const std = @import("std");
+const tbd = @import("tbd");
+const object_symbols = @import("object_symbols");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 6) {
+        std.log.err("usage: {s} <out.txt> <index.tbdi> <libSystem.tbd> <target> <object-or-archive>...", .{args[0]});
+        std.process.exit(1);
+    }
+    const target = args[4];
+
+    var symbols: object_symbols.Symbols = .{};
+    for (args[5..]) |path| {
+        const data = try std.fs.cwd().readFileAlloc(arena, path, std.math.maxInt(u32));
+        object_symbols.read(arena, &symbols, data) catch |err| {
+            std.log.err("{s}: {s}", .{ path, @errorName(err) });
+            std.process.exit(1);
+        };
+    }
+
+    const system = try std.fs.cwd().readFileAlloc(arena, args[3], std.math.maxInt(u32));
+    for (try tbd.parse(arena, system)) |document| {
+        for ([_][]const tbd.Symbols{ document.exports, document.reexports }) |lists| {
+            for (lists) |list| {
+                for (list.targets) |t| {
+                    if (!std.mem.eql(u8, t, target)) continue;
+                    for (list.symbols) |name| try symbols.defined.put(arena, name, {});
+                    for (list.weak_symbols) |name| try symbols.defined.put(arena, name, {});
+                }
+            }
+        }
+    }
+
+    const mapped = try tbd.MappedIndex.open(std.fs.cwd(), args[2]);
+    defer mapped.close();
+
+    var needed: std.StringArrayHashMapUnmanaged(void) = .{};
+    var unresolved: usize = 0;
+    var unlinkable: std.StringArrayHashMapUnmanaged(void) = .{};
+    for (symbols.referenced.keys()) |symbol| {
+        if (symbols.defined.contains(symbol)) continue;
+        const install_name = mapped.index.lookup(target, symbol) orelse {
+            unresolved += 1;
+            continue;
+        };
+        if (try linkable(arena, mapped.index, install_name)) |line| {
+            try needed.put(arena, line, {});
+        } else try unlinkable.put(arena, install_name, {});
+    }
+
+    std.mem.sort([]const u8, needed.keys(), {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    const w = buf.writer();
+    try w.print("# {d} undefined symbols are in no stub of the SDK or libSystem for {s}.\n", .{ unresolved, target });
+    for (unlinkable.keys()) |install_name| {
+        try w.print("# Needed but not re-exported by a public library: {s}\n", .{install_name});
+    }
+    for (needed.keys()) |line| try w.print("{s}\n", .{line});
+    try buf.flush();
+}
+
+/// The `framework <name>` or `library <name>` line that links the library
+/// at `install_name`, or the public library that re-exports it. Null if
+/// there is none.
+fn linkable(arena: std.mem.Allocator, index: tbd.Index, install_name: []const u8) !?[]const u8 {
+    var name = install_name;
+    while (true) {
+        if (tbd.frameworkName(name)) |framework| {
+            return try std.fmt.allocPrint(arena, "framework {s}", .{framework});
+        }
+        if (std.mem.startsWith(u8, name, "/usr/lib/lib") and std.mem.indexOfScalar(u8, name["/usr/lib/".len..], '/') == null) {
+            const base = name["/usr/lib/lib".len..];
+            // libobjc.A.dylib is linked as -lobjc.
+            const library = base[0 .. std.mem.indexOfScalar(u8, base, '.') orelse base.len];
+            return try std.fmt.allocPrint(arena, "library {s}", .{library});
+        }
+        name = index.reexportedBy(name) orelse return null;
+    }
+}
@@ -0,0 +1,236 @@
+//! Objective-C runtime references for Zig code, laid out as clang lays
+//! them out for Objective-C.
+//!
+//! `sel("setDevice:")` and `class("CAMetalLayer")` load from a slot in
+//! `__objc_selrefs` or `__objc_classrefs` that dyld and libobjc fix up once
+//! when the image loads, rather than calling `sel_registerName` or
+//! `objc_getClass` on every use. Each name gets one slot per binary.
+//! `cfString("IOSurfaceWidth")` and `string("name")` are constant
+//! CFString and NSString objects, as `CFSTR("...")` and `@"..."` make,
+//! rather than strings created with `CFStringCreateWithCString` at run time.
+//!
+//! `msgSend` sends a message with the argument and return types of the
+//! method, the way clang calls `objc_msgSend` for a message expression.
+//! With the build option `objc-msgsend-selector-stubs` it calls
+//! `objc_msgSend$<selector>` instead, as clang does with
+//! `-fobjc-msgsend-selector-stubs`: the linker then makes one stub per
+//! selector that loads the selector and jumps to `objc_msgSend`, so call
+//! sites no longer load it themselves.
+//!
+//! Importable from build scripts as `b.dependency("macos_sdk", .{}).module("objc")`.
+const std = @import("std");
+const builtin = @import("builtin");
+const options = @import("objc_options");
+
+/// `id` from <objc/objc.h>.
+pub const id = *opaque {};
+/// `SEL` from <objc/objc.h>.
+pub const SEL = *opaque {};
+/// `Class` from <objc/objc.h>.
+pub const Class = *opaque {};
+/// `IMP` from <objc/objc.h>. Cast it to the method's own function type
+/// before calling it.
+pub const IMP = *const fn () callconv(.c) void;
+
+/// `BOOL` from <objc/objc.h>: `bool` on arm64 and `signed char` on x86_64.
+pub const BOOL = if (builtin.cpu.arch == .aarch64) bool else i8;
+pub const YES: BOOL = if (BOOL == bool) true else 1;
+pub const NO: BOOL = if (BOOL == bool) false else 0;
+
+/// The selector named `name`, e.g. `sel("initWithDevice:")`.
+pub fn sel(comptime name: [:0]const u8) SEL {
+    const S = struct {
+        const methname linksection("__TEXT,__objc_methname,cstring_literals") = name[0..name.len :0].*;
+        var ref: SEL linksection("__DATA,__objc_selrefs,literal_pointers,no_dead_strip") = @ptrCast(@constCast(&methname));
+    };
+    // libobjc replaces the slot's value with the registered selector.
+    // clang marks the slot `externally_initialized`; the volatile load keeps
+    // LLVM from folding it to the string's address instead.
+    return @as(*const volatile SEL, &S.ref).*;
+}
+
+/// The class named `name`, e.g. `class("NSWindow")`. The class must be
+/// exported by a linked library or defined in the image.
+pub fn class(comptime name: []const u8) Class {
+    const S = struct {
+        var ref: Class linksection("__DATA,__objc_classrefs,regular,no_dead_strip") =
+            @extern(Class, .{ .name = "OBJC_CLASS_$_" ++ name });
+    };
+    // libobjc replaces the slot's value if the class is realized elsewhere
+    // (a future class), so it is read the same way as a selector.
+    return @as(*const volatile Class, &S.ref).*;
+}
+
+/// A constant `CFStringRef` with the contents of the UTF-8 `text`, like
+/// `CFSTR("...")`: an immutable CFString in `__DATA,__cfstring` with
+/// CoreFoundation's `__CFConstantStringClassReference` as its class. It is
+/// never allocated or freed. It can be passed wherever a `CFStringRef` or a
+/// `const void *` key is expected. Each text gets one per binary. ASCII
+/// text is stored as bytes in `__TEXT,__cstring`, and other text as UTF-16
+/// in `__TEXT,__ustring`, as clang does.
+pub fn cfString(comptime text: [:0]const u8) *const anyopaque {
+    if (std.mem.indexOfScalar(u8, text, 0) != null) @compileError("constant strings cannot contain NUL");
+    const S = struct {
+        const ascii = for (text) |c| {
+            if (c >= 0x80) break false;
+        } else true;
+        const bytes linksection("__TEXT,__cstring,cstring_literals") = text[0..text.len :0].*;
+        const utf16 linksection("__TEXT,__ustring") = std.unicode.utf8ToUtf16LeStringLiteral(text).*;
+        const literal: ConstantString linksection("__DATA,__cfstring") = if (ascii) .{
+            .isa = @extern(*anyopaque, .{ .name = "__CFConstantStringClassReference" }),
+            .flags = constant_string_bytes,
+            .chars = &bytes,
+            .length = bytes.len,
+        } else .{
+            .isa = @extern(*anyopaque, .{ .name = "__CFConstantStringClassReference" }),
+            .flags = constant_string_utf16,
+            .chars = &utf16,
+            .length = utf16.len,
+        };
+    };
+    return &S.literal;
+}
+
+/// The constant `NSString` with the contents of `text`, like `@"..."`. It
+/// is the same object as `cfString(text)`.
+pub fn string(comptime text: [:0]const u8) id {
+    return @ptrCast(@constCast(cfString(text)));
+}
+
+/// `struct __NSConstantString_tag`, which clang emits for `CFSTR` and
+/// `@"..."` literals.
+const ConstantString = extern struct {
+    isa: *anyopaque,
+    flags: c_int,
+    chars: *const anyopaque,
+    length: c_long,
+};
+
+// The CFString info bits clang sets: immutable, not inline, no
+// deallocator, and either 8-bit or UTF-16 contents.
+const constant_string_bytes = 0x7c8;
+const constant_string_utf16 = 0x7d0;
+
+/// Sends the message `name` to `receiver`, an `id` or a `Class`, with the
+/// arguments in the tuple `args`, and returns the method's result:
+/// `msgSend(f64, layer, "contentsScale", .{})`. The types must be the
+/// method's own. On x86_64, methods that return a structure in memory are
+/// sent with `objc_msgSend_stret` and `long double` ones with
+/// `objc_msgSend_fpret`, as clang does; arm64 always uses `objc_msgSend`.
+/// Only `objc_msgSend` sends go through selector stubs.
+pub inline fn msgSend(comptime Return: type, receiver: anytype, comptime name: [:0]const u8, args: anytype) Return {
+    const Send = MsgSendFn(Return, @TypeOf(receiver), @TypeOf(args));
+    if (options.msgsend_selector_stubs and comptime sendsPlain(Return)) {
+        // The stub takes the arguments where `objc_msgSend` does and
+        // ignores the selector register.
+        const stub = @extern(*const Send, .{ .name = "objc_msgSend$" ++ name });
+        return @call(.auto, stub, .{ receiver, @as(SEL, undefined) } ++ args);
+    }
+    const send: *const Send = @ptrCast(dispatch(Return));
+    return @call(.auto, send, .{ receiver, sel(name) } ++ args);
+}
+
+/// A call site's method implementation for the last class it was sent
+/// to. `send` calls the implementation directly and looks it up again only
+/// when the receiver's class changes, which saves the method cache lookup
+/// of `objc_msgSend` in loops over objects of one class. Keep one per call
+/// site. It is only correct as long as the class's methods are not
+/// replaced, e.g. by swizzling or by loading a category.
+pub const Cache = struct {
+    receiver_class: ?Class = null,
+    imp: ?IMP = null,
+
+    /// Like `msgSend`.
+    pub inline fn send(
+        cache: *Cache,
+        comptime Return: type,
+        receiver: anytype,
+        comptime name: [:0]const u8,
+        args: anytype,
+    ) Return {
+        const selector = sel(name);
+        const receiver_class = object_getClass(@ptrCast(receiver));
+        if (receiver_class != cache.receiver_class) {
+            // For a method the class does not implement, libobjc returns
+            // its forwarding entry point, which forwards the message as
+            // `objc_msgSend` would.
+            const lookup = if (builtin.cpu.arch == .x86_64 and returnsInMemory(Return))
+                &class_getMethodImplementation_stret
+            else
+                &class_getMethodImplementation;
+            cache.imp = lookup(receiver_class, selector);
+            cache.receiver_class = receiver_class;
+        }
+        const imp: *const MsgSendFn(Return, @TypeOf(receiver), @TypeOf(args)) = @ptrCast(cache.imp.?);
+        return @call(.auto, imp, .{ receiver, selector } ++ args);
+    }
+};
+
+/// The type of `objc_msgSend` for one method: the receiver, the selector
+/// and the arguments, with the C calling convention.
+fn MsgSendFn(comptime Return: type, comptime Receiver: type, comptime Args: type) type {
+    const fields = @typeInfo(Args).@"struct".fields;
+    var params: [fields.len + 2]std.builtin.Type.Fn.Param = undefined;
+    params[0] = .{ .is_generic = false, .is_noalias = false, .type = Receiver };
+    params[1] = .{ .is_generic = false, .is_noalias = false, .type = SEL };
+    for (fields, params[2..]) |field, *param| {
+        param.* = .{ .is_generic = false, .is_noalias = false, .type = field.type };
+    }
+    return @Type(.{ .@"fn" = .{
+        .calling_convention = .c,
+        .is_generic = false,
+        .is_var_args = false,
+        .return_type = Return,
+        .params = &params,
+    } });
+}
+
+fn dispatch(comptime Return: type) IMP {
+    if (sendsPlain(Return)) return &objc_msgSend;
+    return if (Return == c_longdouble) &objc_msgSend_fpret else &objc_msgSend_stret;
+}
+
+/// Whether methods returning `Return` are sent with `objc_msgSend` rather
+/// than one of its x86_64 variants.
+fn sendsPlain(comptime Return: type) bool {
+    return builtin.cpu.arch != .x86_64 or (Return != c_longdouble and !returnsInMemory(Return));
+}
+
+/// Whether the x86_64 C calling convention returns `T` through a hidden
+/// pointer: aggregates of more than 16 bytes.
+fn returnsInMemory(comptime T: type) bool {
+    return switch (@typeInfo(T)) {
+        .@"struct", .@"union", .array => @sizeOf(T) > 16,
+        else => false,
+    };
+}
+
+// <objc/message.h> and <objc/runtime.h>. libobjc is re-exported by
+// Foundation, so these resolve wherever Objective-C classes do.
+extern fn objc_msgSend() void;
+extern fn objc_msgSend_stret() void;
+extern fn objc_msgSend_fpret() void;
+extern fn object_getClass(object: ?id) ?Class;
+extern fn class_getMethodImplementation(cls: ?Class, name: SEL) ?IMP;
+extern fn class_getMethodImplementation_stret(cls: ?Class, name: SEL) ?IMP;
+
+/// libobjc only fixes up the references of images with an image info
+/// section. The flags are clang's (`OBJC_IMAGE_HAS_CATEGORY_CLASS_PROPERTIES`).
+/// It is weak so that every copy of this module in a binary shares one.
+const image_info: [2]u32 linksection("__DATA,__objc_imageinfo,regular,no_dead_strip") = .{ 0, 1 << 6 };
+
+comptime {
+    @export(&image_info, .{ .name = "zig_objc_image_info", .linkage = .weak, .visibility = .hidden });
+}
+
+test "x86_64 sends large structures and long double with the variants" {
+    const Rect = extern struct { x: f64, y: f64, w: f64, h: f64 };
+    const Point = extern struct { x: f64, y: f64 };
+    try std.testing.expect(returnsInMemory(Rect));
+    try std.testing.expect(!returnsInMemory(Point));
+    try std.testing.expect(!returnsInMemory([2]u64));
+    try std.testing.expect(sendsPlain(Point));
+    try std.testing.expect(sendsPlain(id));
+    try std.testing.expectEqual(builtin.cpu.arch != .x86_64, sendsPlain(Rect));
+    try std.testing.expectEqual(builtin.cpu.arch != .x86_64, sendsPlain(c_longdouble));
+}
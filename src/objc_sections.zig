@@ -0,0 +1,491 @@
+//! Checks that a Mach-O object built with the `objc` module has the same
+//! Objective-C sections as one clang built from the equivalent Objective-C.
+//! The sections, and the `__cfstring`, `__cstring` and `__ustring` sections
+//! of constant strings, must have the same names, types, attributes and
+//! alignment. The objects must also register the same selector names,
+//! have the same number of selector and class references, refer to the
+//! same classes and have the same image info. Their constant strings must
+//! have the same class, flags, lengths and contents. Finally, they must
+//! call the same `objc_msgSend` variants.
+//!
+//! With `--blocks`, compares the block literals instead: the objects must
+//! have the same block descriptors (size, copy and dispose helpers and
+//! signature) and global blocks with the same flags. The flags of stack
+//! blocks are immediates in the code and are not compared, nor is the
+//! extended layout, which only heap tools read.
+//!
+//! Usage: objc_sections [--blocks] <zig.o> <clang.o>
+//!
+//! Reads 64-bit little-endian objects (arm64 and x86_64) with the layouts
+//! of <mach-o/loader.h>, <mach-o/nlist.h> and <mach-o/reloc.h>.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    const blocks = args.len == 4 and std.mem.eql(u8, args[1], "--blocks");
+    if (args.len != 3 and !blocks) {
+        std.log.err("usage: {s} [--blocks] <zig.o> <clang.o>", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var objects: [2]Object = undefined;
+    for (&objects, args[args.len - 2 ..]) |*object, path| {
+        const data = try std.fs.cwd().readFileAlloc(arena, path, std.math.maxInt(u32));
+        object.* = Object.read(arena, data) catch |err| {
+            std.log.err("{s}: {s}", .{ path, @errorName(err) });
+            std.process.exit(1);
+        };
+    }
+    const zig, const clang = objects;
+    if (blocks) {
+        const literals = [2][]const []const u8{
+            try unique(arena, try sorted(arena, try zig.blockLiterals(arena))),
+            try unique(arena, try sorted(arena, try clang.blockLiterals(arena))),
+        };
+        if (!eql(literals[0], literals[1])) {
+            std.log.err("blocks {s} instead of {s}", .{ literals[0], literals[1] });
+            std.process.exit(1);
+        }
+        return;
+    }
+
+    var failed = false;
+    for (clang.sections.items) |expected| {
+        if (!isCompared(expected.sectname)) continue;
+        const actual = zig.find(expected.sectname) orelse {
+            std.log.err("missing section {s},{s}", .{ expected.segname, expected.sectname });
+            failed = true;
+            continue;
+        };
+        if (!std.mem.eql(u8, actual.segname, expected.segname) or actual.flags != expected.flags or
+            actual.@"align" != expected.@"align")
+        {
+            std.log.err("{s}: {s},0x{x},2^{d} instead of {s},0x{x},2^{d}", .{
+                expected.sectname,
+                actual.segname,
+                actual.flags,
+                actual.@"align",
+                expected.segname,
+                expected.flags,
+                expected.@"align",
+            });
+            failed = true;
+        }
+    }
+    for (zig.sections.items) |section| {
+        if (isCompared(section.sectname) and clang.find(section.sectname) == null) {
+            std.log.err("extra section {s},{s}", .{ section.segname, section.sectname });
+            failed = true;
+        }
+    }
+    if (failed) std.process.exit(1);
+
+    for ([_][]const u8{ "__objc_methname", "__cstring" }) |name| {
+        const strings = [2][]const []const u8{
+            try sorted(arena, try zig.cStrings(arena, name)),
+            try sorted(arena, try clang.cStrings(arena, name)),
+        };
+        if (!eql(strings[0], strings[1])) {
+            std.log.err("{s} strings {s} instead of {s}", .{ name, strings[0], strings[1] });
+            failed = true;
+        }
+    }
+    if (!std.mem.eql(u8, zig.contents("__ustring"), clang.contents("__ustring"))) {
+        std.log.err("UTF-16 strings {x} instead of {x}", .{ zig.contents("__ustring"), clang.contents("__ustring") });
+        failed = true;
+    }
+    for ([_][]const u8{ "__objc_selrefs", "__objc_classrefs" }) |name| {
+        const actual = zig.contents(name).len / 8;
+        const expected = clang.contents(name).len / 8;
+        if (actual != expected) {
+            std.log.err("{d} {s} entries instead of {d}", .{ actual, name, expected });
+            failed = true;
+        }
+    }
+    for ([_][]const u8{ "__objc_classrefs", "__cfstring" }) |name| {
+        const targets = [2][]const []const u8{
+            try sorted(arena, try zig.relocationTargets(arena, name)),
+            try sorted(arena, try clang.relocationTargets(arena, name)),
+        };
+        if (!eql(targets[0], targets[1])) {
+            std.log.err("{s} refers to {s} instead of {s}", .{ name, targets[0], targets[1] });
+            failed = true;
+        }
+    }
+    const constants = [2][]const []const u8{
+        try sorted(arena, try zig.constantStrings(arena)),
+        try sorted(arena, try clang.constantStrings(arena)),
+    };
+    if (!eql(constants[0], constants[1])) {
+        std.log.err("constant strings {s} instead of {s}", .{ constants[0], constants[1] });
+        failed = true;
+    }
+    const sends = [2][]const []const u8{
+        try sorted(arena, try zig.undefinedSymbols(arena, "_objc_msgSend")),
+        try sorted(arena, try clang.undefinedSymbols(arena, "_objc_msgSend")),
+    };
+    if (!eql(sends[0], sends[1])) {
+        std.log.err("calls {s} instead of {s}", .{ sends[0], sends[1] });
+        failed = true;
+    }
+    if (!std.mem.eql(u8, zig.contents("__objc_imageinfo"), clang.contents("__objc_imageinfo"))) {
+        std.log.err("image info {x} instead of {x}", .{
+            zig.contents("__objc_imageinfo"),
+            clang.contents("__objc_imageinfo"),
+        });
+        failed = true;
+    }
+    if (failed) std.process.exit(1);
+}
+
+// <mach-o/loader.h>, <mach-o/nlist.h> and <mach-o/reloc.h>
+const MH_MAGIC_64 = 0xfeedfacf;
+const CPU_TYPE_ARM64 = 0x0100000c;
+const mach_header_64_len = 32;
+const LC_SEGMENT_64 = 0x19;
+const LC_SYMTAB = 0x2;
+const segment_command_64_len = 72;
+const section_64_len = 80;
+const nlist_64_len = 16;
+const N_EXT = 0x01;
+const N_TYPE = 0x0e;
+const N_UNDF = 0x0;
+const N_SECT = 0xe;
+const SECTION_TYPE = 0xff;
+const S_ZEROFILL = 0x1;
+const S_GB_ZEROFILL = 0xc;
+const S_THREAD_LOCAL_ZEROFILL = 0x12;
+const relocation_info_len = 8;
+// X86_64_RELOC_UNSIGNED and ARM64_RELOC_UNSIGNED
+const RELOC_UNSIGNED = 0;
+const ARM64_RELOC_SUBTRACTOR = 1;
+const X86_64_RELOC_SUBTRACTOR = 5;
+/// `struct __NSConstantString_tag`: class, flags, contents and length.
+const constant_string_len = 32;
+
+/// The `__objc_*` sections and those of constant strings.
+fn isCompared(sectname: []const u8) bool {
+    if (std.mem.startsWith(u8, sectname, "__objc_")) return true;
+    for ([_][]const u8{ "__cfstring", "__cstring", "__ustring" }) |name| {
+        if (std.mem.eql(u8, sectname, name)) return true;
+    }
+    return false;
+}
+
+const Section = struct {
+    segname: []const u8,
+    sectname: []const u8,
+    addr: u64,
+    @"align": u32,
+    flags: u32,
+    /// Empty for zero-filled sections.
+    data: []const u8,
+    relocations: []const u8,
+};
+
+/// What a pointer in the object's data points to: an undefined symbol,
+/// or an address in one of its sections.
+const Target = union(enum) {
+    symbol: []const u8,
+    address: u64,
+};
+
+/// The sections and the symbol table of an object.
+const Object = struct {
+    cputype: u32 = 0,
+    sections: std.ArrayListUnmanaged(Section) = .{},
+    symbols: []const u8 = &.{},
+    strings: []const u8 = &.{},
+
+    fn read(arena: std.mem.Allocator, data: []const u8) !Object {
+        if (data.len < mach_header_64_len or readU32(data, 0) != MH_MAGIC_64) return error.NotAnObject;
+        var object: Object = .{ .cputype = readU32(data, 4) };
+        const ncmds = readU32(data, 16);
+        var pos: usize = mach_header_64_len;
+        for (0..ncmds) |_| {
+            if (pos + 8 > data.len) return error.InvalidObject;
+            const cmd = readU32(data, pos);
+            const cmdsize = readU32(data, pos + 4);
+            if (cmdsize < 8 or pos + cmdsize > data.len) return error.InvalidObject;
+            switch (cmd) {
+                LC_SEGMENT_64 => {
+                    const nsects = readU32(data, pos + 64);
+                    if (segment_command_64_len + @as(u64, nsects) * section_64_len > cmdsize) return error.InvalidObject;
+                    for (0..nsects) |i| {
+                        const header = data[pos + segment_command_64_len + i * section_64_len ..][0..section_64_len];
+                        const size = std.mem.readInt(u64, header[40..48], .little);
+                        const offset = readU32(header, 48);
+                        const reloff = readU32(header, 56);
+                        const nreloc = readU32(header, 60);
+                        const flags = readU32(header, 64);
+                        const zerofill = switch (flags & SECTION_TYPE) {
+                            S_ZEROFILL, S_GB_ZEROFILL, S_THREAD_LOCAL_ZEROFILL => true,
+                            else => false,
+                        };
+                        if ((!zerofill and offset + size > data.len) or
+                            reloff + @as(u64, nreloc) * relocation_info_len > data.len)
+                            return error.InvalidObject;
+                        try object.sections.append(arena, .{
+                            .segname = std.mem.sliceTo(header[16..32], 0),
+                            .sectname = std.mem.sliceTo(header[0..16], 0),
+                            .addr = std.mem.readInt(u64, header[32..40], .little),
+                            .@"align" = readU32(header, 52),
+                            .flags = flags,
+                            .data = if (zerofill) &.{} else data[offset..][0..@intCast(size)],
+                            .relocations = data[reloff..][0 .. nreloc * relocation_info_len],
+                        });
+                    }
+                },
+                LC_SYMTAB => {
+                    const symoff = readU32(data, pos + 8);
+                    const nsyms = readU32(data, pos + 12);
+                    const stroff = readU32(data, pos + 16);
+                    const strsize = readU32(data, pos + 20);
+                    if (@as(u64, symoff) + @as(u64, nsyms) * nlist_64_len > data.len or
+                        @as(u64, stroff) + strsize > data.len) return error.InvalidObject;
+                    object.symbols = data[symoff..][0 .. nsyms * nlist_64_len];
+                    object.strings = data[stroff..][0..strsize];
+                },
+                else => {},
+            }
+            pos += cmdsize;
+        }
+        return object;
+    }
+
+    fn find(object: Object, sectname: []const u8) ?Section {
+        for (object.sections.items) |section| {
+            if (std.mem.eql(u8, section.sectname, sectname)) return section;
+        }
+        return null;
+    }
+
+    /// The NUL-terminated strings of a `cstring_literals` section.
+    fn cStrings(object: Object, arena: std.mem.Allocator, sectname: []const u8) ![]const []const u8 {
+        const section = object.find(sectname) orelse return &.{};
+        var list = std.ArrayList([]const u8).init(arena);
+        var it = std.mem.splitScalar(u8, std.mem.trimRight(u8, section.data, "\x00"), 0);
+        while (it.next()) |s| try list.append(s);
+        return list.items;
+    }
+
+    /// The contents of a section, or nothing if there is no such section.
+    fn contents(object: Object, sectname: []const u8) []const u8 {
+        return if (object.find(sectname)) |section| section.data else &.{};
+    }
+
+    /// The names of the external symbols that the relocations of a
+    /// section refer to.
+    fn relocationTargets(object: Object, arena: std.mem.Allocator, sectname: []const u8) ![]const []const u8 {
+        const section = object.find(sectname) orelse return &.{};
+        var names = std.ArrayList([]const u8).init(arena);
+        var pos: usize = 0;
+        while (pos < section.relocations.len) : (pos += relocation_info_len) {
+            const info = readU32(section.relocations, pos + 4);
+            const symbolnum = info & 0xffffff;
+            const is_extern = (info >> 27) & 1 != 0;
+            if (!is_extern) continue;
+            if ((symbolnum + 1) * nlist_64_len > object.symbols.len) return error.InvalidObject;
+            // zig names its constants, e.g. the contents of a string, with
+            // local symbols where clang uses temporary labels.
+            if (object.symbols[symbolnum * nlist_64_len + 4] & N_EXT == 0) continue;
+            const strx = readU32(object.symbols, symbolnum * nlist_64_len);
+            if (strx >= object.strings.len) return error.InvalidObject;
+            try names.append(std.mem.sliceTo(object.strings[strx..], 0));
+        }
+        return names.items;
+    }
+
+    /// The flags and length of each constant string, as `0x7c8/5`.
+    fn constantStrings(object: Object, arena: std.mem.Allocator) ![]const []const u8 {
+        const data = object.contents("__cfstring");
+        if (data.len % constant_string_len != 0) return error.InvalidObject;
+        var list = std.ArrayList([]const u8).init(arena);
+        var pos: usize = 0;
+        while (pos < data.len) : (pos += constant_string_len) {
+            try list.append(try std.fmt.allocPrint(arena, "0x{x}/{d}", .{
+                readU32(data, pos + 8),
+                std.mem.readInt(u64, data[pos + 24 ..][0..8], .little),
+            }));
+        }
+        return list.items;
+    }
+
+    /// The external symbols the object uses and does not define whose names
+    /// start with `prefix`.
+    fn undefinedSymbols(object: Object, arena: std.mem.Allocator, prefix: []const u8) ![]const []const u8 {
+        var names = std.ArrayList([]const u8).init(arena);
+        var pos: usize = 0;
+        while (pos < object.symbols.len) : (pos += nlist_64_len) {
+            const n_type = object.symbols[pos + 4];
+            if (n_type & N_EXT == 0 or n_type & N_TYPE != N_UNDF) continue;
+            const strx = readU32(object.symbols, pos);
+            if (strx >= object.strings.len) return error.InvalidObject;
+            const name = std.mem.sliceTo(object.strings[strx..], 0);
+            if (std.mem.startsWith(u8, name, prefix)) try names.append(name);
+        }
+        return names.items;
+    }
+
+    /// Each global block literal, as `global 0x<flags> <descriptor>`,
+    /// and each block descriptor, as `descriptor <size> [copy/dispose]
+    /// <signature>`. A descriptor is found by its signature, the only
+    /// string in the object that contains `@?0`, the block's own argument.
+    fn blockLiterals(object: Object, arena: std.mem.Allocator) ![]const []const u8 {
+        const pointers = try object.dataPointers(arena);
+        var list = std.ArrayList([]const u8).init(arena);
+        var it = pointers.iterator();
+        while (it.next()) |pointer| switch (pointer.value_ptr.*) {
+            .symbol => |name| if (std.mem.eql(u8, name, "__NSConcreteGlobalBlock")) {
+                const literal = pointer.key_ptr.*;
+                const descriptor = switch (pointers.get(literal + 24) orelse return error.InvalidObject) {
+                    .address => |address| address,
+                    .symbol => return error.InvalidObject,
+                };
+                try list.append(try std.fmt.allocPrint(arena, "global 0x{x} {s}", .{
+                    try object.readAt(u32, literal + 8),
+                    try object.blockDescriptor(arena, pointers, descriptor),
+                }));
+            },
+            .address => |address| if (object.isBlockSignature(address)) {
+                // The copy and dispose helpers come before the signature.
+                const slot = pointer.key_ptr.*;
+                if (slot < 16) return error.InvalidObject;
+                const helpers = slot >= 32 and pointers.contains(slot - 16) and pointers.contains(slot - 8);
+                const descriptor = slot - @as(u64, if (helpers) 32 else 16);
+                try list.append(try std.fmt.allocPrint(arena, "descriptor {s}", .{
+                    try object.blockDescriptor(arena, pointers, descriptor),
+                }));
+            },
+        };
+        return list.items;
+    }
+
+    /// `<size> [copy/dispose] <signature>` of the descriptor at `address`.
+    /// Whether it has helpers is told by where its signature is, as the
+    /// flags of a stack block are not in the data.
+    fn blockDescriptor(
+        object: Object,
+        arena: std.mem.Allocator,
+        pointers: std.AutoHashMap(u64, Target),
+        address: u64,
+    ) ![]const u8 {
+        const size = try object.readAt(u64, address + 8);
+        for ([_]u64{ 16, 32 }) |offset| {
+            const signature = switch (pointers.get(address + offset) orelse continue) {
+                .address => |target| target,
+                .symbol => continue,
+            };
+            if (!object.isBlockSignature(signature)) continue;
+            return std.fmt.allocPrint(arena, "{d}{s} {s}", .{
+                size,
+                if (offset == 32) " copy/dispose" else "",
+                try object.cStringAt(signature),
+            });
+        }
+        return error.InvalidObject;
+    }
+
+    fn isBlockSignature(object: Object, address: u64) bool {
+        const string = object.cStringAt(address) catch return false;
+        return std.mem.indexOf(u8, string, "@?0") != null;
+    }
+
+    /// The pointers stored in the object's sections, by the address they
+    /// are stored at. Debug info, unwind info and pointer differences are
+    /// left out.
+    fn dataPointers(object: Object, arena: std.mem.Allocator) !std.AutoHashMap(u64, Target) {
+        const subtractor: u32 = if (object.cputype == CPU_TYPE_ARM64) ARM64_RELOC_SUBTRACTOR else X86_64_RELOC_SUBTRACTOR;
+        var pointers = std.AutoHashMap(u64, Target).init(arena);
+        for (object.sections.items) |section| {
+            if (std.mem.eql(u8, section.segname, "__DWARF") or std.mem.eql(u8, section.segname, "__LD") or
+                std.mem.eql(u8, section.sectname, "__eh_frame")) continue;
+            var after_subtractor = false;
+            var pos: usize = 0;
+            while (pos < section.relocations.len) : (pos += relocation_info_len) {
+                const r_address = readU32(section.relocations, pos);
+                const info = readU32(section.relocations, pos + 4);
+                const r_type = info >> 28;
+                defer after_subtractor = r_type == subtractor;
+                const pcrel = (info >> 24) & 1 != 0;
+                const length = (info >> 25) & 3;
+                if (r_type != RELOC_UNSIGNED or pcrel or length != 3 or after_subtractor) continue;
+                if (@as(u64, r_address) + 8 > section.data.len) return error.InvalidObject;
+                // The addend, or without a symbol the address itself.
+                const value = std.mem.readInt(u64, section.data[r_address..][0..8], .little);
+                const symbolnum = info & 0xffffff;
+                const target: Target = if ((info >> 27) & 1 == 0) .{ .address = value } else blk: {
+                    if ((symbolnum + 1) * nlist_64_len > object.symbols.len) return error.InvalidObject;
+                    const symbol = object.symbols[symbolnum * nlist_64_len ..][0..nlist_64_len];
+                    if (symbol[4] & N_TYPE == N_SECT) {
+                        break :blk .{ .address = std.mem.readInt(u64, symbol[8..16], .little) +% value };
+                    }
+                    const strx = readU32(symbol, 0);
+                    if (strx >= object.strings.len) return error.InvalidObject;
+                    break :blk .{ .symbol = std.mem.sliceTo(object.strings[strx..], 0) };
+                };
+                try pointers.put(section.addr + r_address, target);
+            }
+        }
+        return pointers;
+    }
+
+    /// The bytes from `address` to the end of its section.
+    fn bytesAt(object: Object, address: u64) ![]const u8 {
+        for (object.sections.items) |section| {
+            if (address >= section.addr and address < section.addr + section.data.len) {
+                return section.data[@intCast(address - section.addr)..];
+            }
+        }
+        return error.InvalidObject;
+    }
+
+    fn readAt(object: Object, comptime T: type, address: u64) !T {
+        const bytes = try object.bytesAt(address);
+        if (bytes.len < @sizeOf(T)) return error.InvalidObject;
+        return std.mem.readInt(T, bytes[0..@sizeOf(T)], .little);
+    }
+
+    fn cStringAt(object: Object, address: u64) ![]const u8 {
+        const bytes = try object.bytesAt(address);
+        const end = std.mem.indexOfScalar(u8, bytes, 0) orelse return error.InvalidObject;
+        return bytes[0..end];
+    }
+};
+
+/// The sorted `list` without repeats: clang emits one descriptor for all
+/// the blocks with the same layout, zig one per block type.
+fn unique(arena: std.mem.Allocator, list: []const []const u8) ![]const []const u8 {
+    var items = std.ArrayList([]const u8).init(arena);
+    for (list) |item| {
+        if (items.items.len > 0 and std.mem.eql(u8, items.getLast(), item)) continue;
+        try items.append(item);
+    }
+    return items.items;
+}
+
+fn sorted(arena: std.mem.Allocator, list: []const []const u8) ![]const []const u8 {
+    const copy = try arena.dupe([]const u8, list);
+    std.mem.sort([]const u8, copy, {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+    return copy;
+}
+
+fn eql(a: []const []const u8, b: []const []const u8) bool {
+    if (a.len != b.len) return false;
+    for (a, b) |x, y| {
+        if (!std.mem.eql(u8, x, y)) return false;
+    }
+    return true;
+}
+
+fn readU32(bytes: []const u8, offset: usize) u32 {
+    return std.mem.readInt(u32, bytes[offset..][0..4], .little);
+}
@@ -0,0 +1,1635 @@
+//! Generates typed Zig wrappers for the Objective-C methods that the given
+//! frameworks declare.
+//!
+//! Usage: objc_shims [--imp-cache] <out.zig> <preprocessed.i> <framework>...
+//!
+//! `<preprocessed.i>` is `clang -E` output, with line markers, of a source
+//! that imports the frameworks. Every class, category and protocol that
+//! their headers declare, and the root class `NSObject` from
+//! <objc/NSObject.h>, becomes a struct with an inline function per
+//! method and property accessor: `NSView.setNeedsDisplay_(view, true)`
+//! sends `setNeedsDisplay:` through `objc.msgSend` with the argument and
+//! return types of the declaration. The structs, typedefs and enum
+//! constants those types need are declared next to them.
+//!
+//! Methods that take variable arguments, that pass unions, bitfields,
+//! vectors or `va_list` by value, or that are unavailable on macOS are
+//! left out. With `--imp-cache`, each struct also has a `Cached` namespace
+//! with the same functions, taking an `*objc.Cache` first.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    var rest = args[1..];
+    const imp_cache = rest.len > 0 and eql(rest[0], "--imp-cache");
+    if (imp_cache) rest = rest[1..];
+    if (rest.len < 3) {
+        std.log.err("usage: {s} [--imp-cache] <out.zig> <preprocessed.i> <framework>...", .{args[0]});
+        std.process.exit(1);
+    }
+    const out_path = rest[0];
+    const in_path = rest[1];
+    const frameworks = rest[2..];
+
+    const text = try std.fs.cwd().readFileAlloc(arena, in_path, std.math.maxInt(u32));
+    const tokens = try stripAttributes(arena, try tokenize(arena, text, frameworks));
+    var parser: Parser = .{ .arena = arena, .texts = tokens.items(.text), .selected = tokens.items(.selected) };
+    parser.parse() catch |err| {
+        std.log.err("{s}: {s}", .{ in_path, @errorName(err) });
+        std.process.exit(1);
+    };
+
+    var emitter = try Emitter.init(arena, &parser);
+    const source = try emitter.emit(frameworks, imp_cache);
+    try std.fs.cwd().writeFile(.{ .sub_path = out_path, .data = source });
+}
+
+const Token = struct {
+    text: []const u8,
+    /// Whether the token comes from a header of one of the frameworks.
+    selected: bool,
+};
+
+/// Stands in for an attribute that makes a declaration unavailable on macOS.
+const unavailable_marker = "@unavailable";
+/// Stands in for an attribute that changes the layout of a type, such as
+/// `aligned`, `packed` or `ext_vector_type`.
+const layout_marker = "@layout";
+
+fn tokenize(arena: std.mem.Allocator, text: []const u8, frameworks: []const []const u8) !std.MultiArrayList(Token) {
+    var tokens: std.MultiArrayList(Token) = .{};
+    var selected = false;
+    var line_start = true;
+    var i: usize = 0;
+    while (i < text.len) {
+        const c = text[i];
+        if (c == '\n') {
+            line_start = true;
+            i += 1;
+            continue;
+        }
+        if (std.ascii.isWhitespace(c)) {
+            i += 1;
+            continue;
+        }
+        if (line_start and c == '#') {
+            const end = std.mem.indexOfScalarPos(u8, text, i, '\n') orelse text.len;
+            if (markerPath(text[i..end])) |path| selected = inFrameworks(path, frameworks);
+            i = end;
+            continue;
+        }
+        line_start = false;
+        const start = i;
+        const next = if (i + 1 < text.len) text[i + 1] else 0;
+        if (isIdentStart(c) or (c == '@' and isIdentStart(next))) {
+            i += 1;
+            while (i < text.len and isIdentChar(text[i])) i += 1;
+        } else if (std.ascii.isDigit(c) or (c == '.' and std.ascii.isDigit(next))) {
+            // A preprocessing number: digits, letters, `.` and signed exponents.
+            i += 1;
+            while (i < text.len) : (i += 1) {
+                const d = text[i];
+                if (isIdentChar(d) or d == '.') continue;
+                if ((d == '+' or d == '-') and std.mem.indexOfScalar(u8, "eEpP", text[i - 1]) != null) continue;
+                break;
+            }
+        } else if (c == '"' or c == '\'' or (c == '@' and next == '"')) {
+            if (c == '@') i += 1;
+            const quote = text[i];
+            i += 1;
+            while (i < text.len and text[i] != quote) : (i += 1) {
+                if (text[i] == '\\') i += 1;
+            }
+            i = @min(i + 1, text.len);
+        } else if (std.mem.startsWith(u8, text[i..], "...")) {
+            i += 3;
+        } else {
+            i += 1;
+        }
+        try tokens.append(arena, .{ .text = text[start..i], .selected = selected });
+    }
+    return tokens;
+}
+
+/// The file of a line marker (`# 12 "path" 1 3`), or null for other
+/// directives such as `#pragma`.
+fn markerPath(line: []const u8) ?[]const u8 {
+    var rest = std.mem.trimLeft(u8, line[1..], " \t");
+    if (std.mem.startsWith(u8, rest, "line")) rest = std.mem.trimLeft(u8, rest[4..], " \t");
+    if (rest.len == 0 or !std.ascii.isDigit(rest[0])) return null;
+    const open = std.mem.indexOfScalar(u8, rest, '"') orelse return null;
+    const close = std.mem.indexOfScalarPos(u8, rest, open + 1, '"') orelse return null;
+    return rest[open + 1 .. close];
+}
+
+/// Whether the innermost framework bundle of `path` is one of `frameworks`,
+/// so that CoreGraphics headers inside ApplicationServices count as
+/// CoreGraphics. libobjc's <objc/NSObject.h>, which declares `alloc`,
+/// `init` and `release`, always counts.
+fn inFrameworks(path: []const u8, frameworks: []const []const u8) bool {
+    if (std.mem.endsWith(u8, path, "/objc/NSObject.h")) return true;
+    const end = std.mem.lastIndexOf(u8, path, ".framework/") orelse return false;
+    const start = if (std.mem.lastIndexOfScalar(u8, path[0..end], '/')) |slash| slash + 1 else 0;
+    for (frameworks) |name| {
+        if (eql(path[start..end], name)) return true;
+    }
+    return false;
+}
+
+/// Drops `__attribute__((...))`, `__asm(...)` and `__extension__`, leaving
+/// `unavailable_marker` or `layout_marker` in place of the attributes that
+/// matter here.
+fn stripAttributes(arena: std.mem.Allocator, tokens: std.MultiArrayList(Token)) !std.MultiArrayList(Token) {
+    const texts = tokens.items(.text);
+    const selected = tokens.items(.selected);
+    var out: std.MultiArrayList(Token) = .{};
+    var i: usize = 0;
+    while (i < texts.len) {
+        const t = texts[i];
+        if (eql(t, "__extension__")) {
+            i += 1;
+            continue;
+        }
+        const is_attribute = eql(t, "__attribute__") or eql(t, "__attribute");
+        const is_asm = eql(t, "__asm") or eql(t, "__asm__");
+        if ((is_attribute or is_asm) and i + 1 < texts.len and eql(texts[i + 1], "(")) {
+            const end = try closing(texts, i + 1);
+            if (is_attribute) {
+                const attribute = texts[i + 2 .. end];
+                if (unavailableOnMacos(attribute)) {
+                    try out.append(arena, .{ .text = unavailable_marker, .selected = selected[i] });
+                }
+                if (changesLayout(attribute)) {
+                    try out.append(arena, .{ .text = layout_marker, .selected = selected[i] });
+                }
+            }
+            i = end + 1;
+            continue;
+        }
+        try out.append(arena, .{ .text = t, .selected = selected[i] });
+        i += 1;
+    }
+    return out;
+}
+
+fn unavailableOnMacos(attribute: []const []const u8) bool {
+    var i: usize = 0;
+    while (i < attribute.len) : (i += 1) {
+        if (eql(attribute[i], "availability") and i + 1 < attribute.len and eql(attribute[i + 1], "(")) {
+            const end = closing(attribute, i + 1) catch return false;
+            const arguments = attribute[i + 2 .. end];
+            if (arguments.len > 0 and (eql(arguments[0], "macos") or eql(arguments[0], "macosx")) and
+                contains(arguments, "unavailable")) return true;
+            i = end;
+        } else if (eql(attribute[i], "unavailable") or eql(attribute[i], "__unavailable__")) {
+            return true;
+        }
+    }
+    return false;
+}
+
+fn changesLayout(attribute: []const []const u8) bool {
+    const names = [_][]const u8{ "aligned", "packed", "ext_vector_type", "vector_size", "mode", "matrix_type" };
+    for (attribute) |t| {
+        const name = if (t.len > 4 and std.mem.startsWith(u8, t, "__") and std.mem.endsWith(u8, t, "__")) t[2 .. t.len - 2] else t;
+        for (names) |n| {
+            if (eql(name, n)) return true;
+        }
+    }
+    return false;
+}
+
+const Struct = struct {
+    tag: []const u8,
+    body: []const []const u8,
+    layout: bool,
+    /// The name the struct is declared under, once known.
+    name: ?[]const u8 = null,
+    state: enum { unvisited, visiting, done, failed } = .unvisited,
+};
+
+const Enum = struct {
+    tag: []const u8,
+    /// The underlying type of `enum X : T`.
+    fixed: ?[]const []const u8,
+    body: ?[]const []const u8,
+    selected: bool,
+};
+
+const Param = struct {
+    name: []const u8,
+    type: []const []const u8,
+};
+
+const Method = struct {
+    selector: []const u8,
+    result: []const []const u8,
+    params: []const Param,
+    is_class: bool,
+    unavailable: bool,
+};
+
+/// The declarations of a class or protocol in the selected frameworks,
+/// with those of its categories.
+const Container = struct {
+    name: []const u8,
+    methods: std.ArrayListUnmanaged(Method) = .{},
+    /// The type parameters of `@interface NSArray<ObjectType>`.
+    generics: std.StringHashMapUnmanaged(void) = .{},
+};
+
+const Tagged = struct {
+    type: []const []const u8,
+    next: usize,
+};
+
+/// Reads the top-level declarations of a translation unit: typedefs,
+/// structs, enums and Objective-C containers. Function bodies, functions
+/// and variables are skipped.
+const Parser = struct {
+    arena: std.mem.Allocator,
+    texts: []const []const u8,
+    selected: []const bool,
+    /// In declaration order; the first typedef of a name wins.
+    typedefs: std.StringArrayHashMapUnmanaged([]const []const u8) = .{},
+    struct_tags: std.StringHashMapUnmanaged(*Struct) = .{},
+    enums: std.ArrayListUnmanaged(*Enum) = .{},
+    enum_tags: std.StringHashMapUnmanaged(*Enum) = .{},
+    /// Every class declared with `@class` or `@interface`.
+    classes: std.StringHashMapUnmanaged(void) = .{},
+    containers: std.StringArrayHashMapUnmanaged(*Container) = .{},
+    anonymous: u32 = 0,
+
+    fn at(p: *const Parser, i: usize) ![]const u8 {
+        if (i >= p.texts.len) return error.UnexpectedEnd;
+        return p.texts[i];
+    }
+
+    fn parse(p: *Parser) !void {
+        var i: usize = 0;
+        while (i < p.texts.len) {
+            const t = p.texts[i];
+            if (eql(t, "typedef")) {
+                i = try p.typedef(i + 1);
+            } else if (isTagKeyword(t)) {
+                i = (try p.tagged(i)).next;
+            } else if (eql(t, "@class")) {
+                i += 1;
+                while (!eql(try p.at(i), ";")) {
+                    if (eql(p.texts[i], "<")) {
+                        i = try skipAngles(p.texts, i);
+                        continue;
+                    }
+                    if (isIdent(p.texts[i])) try p.classes.put(p.arena, p.texts[i], {});
+                    i += 1;
+                }
+                i += 1;
+            } else if (eql(t, "@interface") or eql(t, "@protocol")) {
+                i = try p.container(i);
+            } else if (eql(t, "{")) {
+                i = try closing(p.texts, i) + 1;
+            } else {
+                i += 1;
+            }
+        }
+    }
+
+    fn define(p: *Parser, name: []const u8, typ: []const []const u8) !void {
+        const entry = try p.typedefs.getOrPut(p.arena, name);
+        if (!entry.found_existing) entry.value_ptr.* = typ;
+    }
+
+    /// `struct`, `union` or `enum` with an optional tag, fixed underlying
+    /// type and body, starting at the keyword. Records the structs and
+    /// enums that have a body; anonymous ones get a tag of their own.
+    fn tagged(p: *Parser, start: usize) !Tagged {
+        const kind = p.texts[start];
+        var i = start + 1;
+        var layout = false;
+        while (isMarker(try p.at(i))) : (i += 1) {
+            if (eql(p.texts[i], layout_marker)) layout = true;
+        }
+        var tag: ?[]const u8 = null;
+        if (isIdent(p.texts[i])) {
+            tag = p.texts[i];
+            i += 1;
+        }
+
+        var fixed: ?[]const []const u8 = null;
+        if (eql(kind, "enum") and eql(try p.at(i), ":")) {
+            // `enum X : NSUInteger {`, or `enum X : NSUInteger X;` from
+            // NS_ENUM, where the declarator repeats the tag.
+            var k = i + 1;
+            while (true) : (k += 1) {
+                const t = try p.at(k);
+                if (eql(t, "{") or eql(t, ")")) break;
+                if (eql(t, ";") or eql(t, ",")) {
+                    k -= 1;
+                    break;
+                }
+                if (k > i + 1 and tag != null and eql(t, tag.?)) break;
+            }
+            fixed = p.texts[i + 1 .. k];
+            i = k;
+        }
+
+        if (eql(try p.at(i), "{")) {
+            var end = try closing(p.texts, i);
+            const body = p.texts[i + 1 .. end];
+            while (end + 1 < p.texts.len and isMarker(p.texts[end + 1])) : (end += 1) {
+                if (eql(p.texts[end + 1], layout_marker)) layout = true;
+            }
+            const name = tag orelse name: {
+                defer p.anonymous += 1;
+                break :name try std.fmt.allocPrint(p.arena, "${d}", .{p.anonymous});
+            };
+            if (eql(kind, "struct")) {
+                const entry = try p.struct_tags.getOrPut(p.arena, name);
+                if (!entry.found_existing) {
+                    entry.value_ptr.* = try p.arena.create(Struct);
+                    entry.value_ptr.*.* = .{ .tag = name, .body = body, .layout = layout };
+                }
+            } else if (eql(kind, "enum")) {
+                const e = try p.arena.create(Enum);
+                e.* = .{ .tag = name, .fixed = fixed, .body = body, .selected = p.selected[i] };
+                try p.enums.append(p.arena, e);
+                const entry = try p.enum_tags.getOrPut(p.arena, name);
+                if (!entry.found_existing) entry.value_ptr.* = e;
+            }
+            return .{ .type = try p.arena.dupe([]const u8, &.{ kind, name }), .next = end + 1 };
+        }
+
+        if (eql(kind, "enum") and fixed != null and tag != null) {
+            const entry = try p.enum_tags.getOrPut(p.arena, tag.?);
+            if (!entry.found_existing) {
+                entry.value_ptr.* = try p.arena.create(Enum);
+                entry.value_ptr.*.* = .{ .tag = tag.?, .fixed = fixed, .body = null, .selected = p.selected[start] };
+            } else if (entry.value_ptr.*.fixed == null) {
+                entry.value_ptr.*.fixed = fixed;
+            }
+        }
+        const typ = if (tag) |t| try p.arena.dupe([]const u8, &.{ kind, t }) else try p.arena.dupe([]const u8, &.{kind});
+        return .{ .type = typ, .next = i };
+    }
+
+    /// A typedef, starting after the keyword. Function pointer and block
+    /// typedefs are recorded as `( * )` or `( ^ )` and array typedefs as
+    /// `[`; only their kind matters.
+    fn typedef(p: *Parser, start: usize) !usize {
+        var base: []const []const u8 = &.{};
+        var i = start;
+        if (isTagKeyword(try p.at(i))) {
+            const t = try p.tagged(i);
+            base = t.type;
+            i = t.next;
+        }
+        var end = i;
+        var depth: usize = 0;
+        while (true) : (end += 1) {
+            const t = try p.at(end);
+            if (isOpen(t)) {
+                depth += 1;
+            } else if (isClose(t)) {
+                depth -|= 1;
+            } else if (depth == 0 and eql(t, ";")) {
+                break;
+            }
+        }
+
+        var spec = base;
+        const declarators = try splitTopLevel(p.arena, p.texts[i..end], ",");
+        for (declarators, 0..) |raw, n| {
+            const d = try without(p.arena, raw, unavailable_marker);
+            if (indexOf(d, "(")) |paren| {
+                if (paren + 2 < d.len and (eql(d[paren + 1], "*") or eql(d[paren + 1], "^")) and isIdent(d[paren + 2])) {
+                    try p.define(d[paren + 2], try p.arena.dupe([]const u8, &.{ "(", d[paren + 1], ")" }));
+                }
+                continue;
+            }
+            if (indexOf(d, "[")) |bracket| {
+                if (bracket > 0) try p.define(d[bracket - 1], try p.arena.dupe([]const u8, &.{"["}));
+                continue;
+            }
+            if (d.len == 0 or !isIdent(d[d.len - 1])) continue;
+            const declarator = d[0 .. d.len - 1];
+            const typ = try concat(p.arena, if (n == 0) base else spec, declarator);
+            if (n == 0) spec = try concat(p.arena, base, try without(p.arena, declarator, "*"));
+            try p.define(d[d.len - 1], typ);
+        }
+        return end + 1;
+    }
+
+    /// `@interface` or `@protocol`, up to and including `@end`. Only the
+    /// containers of the selected frameworks keep their methods.
+    fn container(p: *Parser, start: usize) !usize {
+        const is_protocol = eql(p.texts[start], "@protocol");
+        const name = try p.at(start + 1);
+        var i = start + 2;
+        if (is_protocol and (eql(try p.at(i), ";") or eql(p.texts[i], ","))) {
+            while (!eql(try p.at(i), ";")) i += 1;
+            return i + 1;
+        }
+        var c: ?*Container = null;
+        if (p.selected[start]) {
+            const entry = try p.containers.getOrPut(p.arena, name);
+            if (!entry.found_existing) {
+                entry.value_ptr.* = try p.arena.create(Container);
+                entry.value_ptr.*.* = .{ .name = name };
+            }
+            c = entry.value_ptr.*;
+        }
+        if (!is_protocol) {
+            try p.classes.put(p.arena, name, {});
+            if (eql(try p.at(i), "<")) {
+                const end = try skipAngles(p.texts, i);
+                var depth: usize = 0;
+                for (p.texts[i .. end - 1], i..) |t, k| {
+                    if (eql(t, "<")) depth += 1 else if (eql(t, ">")) depth -= 1;
+                    if (depth != 1 or !isIdent(t) or eql(t, "__covariant") or eql(t, "__contravariant")) continue;
+                    const next = p.texts[k + 1];
+                    if (eql(next, ",") or eql(next, ">") or eql(next, ":")) {
+                        if (c) |container_| try container_.generics.put(p.arena, t, {});
+                    }
+                }
+                i = end;
+            }
+        }
+
+        // Superclass, adopted protocols, category name and instance variables.
+        while (true) {
+            const t = try p.at(i);
+            if (eql(t, ":")) {
+                i += 2;
+            } else if (eql(t, "<")) {
+                i = try skipAngles(p.texts, i);
+            } else if (eql(t, "(") or eql(t, "{")) {
+                i = try closing(p.texts, i) + 1;
+            } else if (isMarker(t)) {
+                i += 1;
+            } else {
+                break;
+            }
+        }
+
+        while (!eql(try p.at(i), "@end")) {
+            const t = p.texts[i];
+            if (eql(t, "-") or eql(t, "+")) {
+                i = try p.method(i, c);
+            } else if (eql(t, "@property")) {
+                i = try p.property(i, c);
+            } else if (eql(t, "@optional") or eql(t, "@required")) {
+                i += 1;
+            } else if (eql(t, "typedef")) {
+                i = try p.typedef(i + 1);
+            } else if (isTagKeyword(t)) {
+                i = (try p.tagged(i)).next;
+            } else {
+                while (true) {
+                    const u = try p.at(i);
+                    if (eql(u, ";") or eql(u, "@end")) break;
+                    i = if (eql(u, "(") or eql(u, "{")) try closing(p.texts, i) + 1 else i + 1;
+                }
+                if (eql(p.texts[i], ";")) i += 1;
+            }
+        }
+        return i + 1;
+    }
+
+    fn method(p: *Parser, start: usize, c: ?*Container) !usize {
+        var end = start + 1;
+        while (true) : (end += 1) {
+            const t = try p.at(end);
+            if (eql(t, ";") or eql(t, "{")) break;
+        }
+        const container_ = c orelse return end + 1;
+        const tokens = p.texts[start + 1 .. end];
+        const m = try withoutMarkers(p.arena, tokens);
+
+        var k: usize = 0;
+        var result: []const []const u8 = &.{"id"};
+        if (m.len > 0 and eql(m[0], "(")) {
+            const close = try closing(m, 0);
+            result = m[1..close];
+            k = close + 1;
+        }
+        var selector = std.ArrayList(u8).init(p.arena);
+        var params = std.ArrayList(Param).init(p.arena);
+        while (k < m.len) {
+            const t = m[k];
+            // `, ...` after the last parameter.
+            if (eql(t, ",")) return end + 1;
+            if (eql(t, ":") or (isIdent(t) and k + 1 < m.len and eql(m[k + 1], ":"))) {
+                if (!eql(t, ":")) {
+                    try selector.appendSlice(t);
+                    k += 1;
+                }
+                try selector.append(':');
+                k += 1;
+                var typ: []const []const u8 = &.{"id"};
+                if (k < m.len and eql(m[k], "(")) {
+                    const close = try closing(m, k);
+                    typ = m[k + 1 .. close];
+                    k = close + 1;
+                }
+                if (k >= m.len) return error.UnexpectedEnd;
+                try params.append(.{ .name = m[k], .type = typ });
+                k += 1;
+            } else if (isIdent(t) and selector.items.len == 0) {
+                try selector.appendSlice(t);
+                k += 1;
+            } else {
+                k += 1;
+            }
+        }
+        try container_.methods.append(p.arena, .{
+            .selector = selector.items,
+            .result = result,
+            .params = params.items,
+            .is_class = eql(p.texts[start], "+"),
+            .unavailable = contains(tokens, unavailable_marker),
+        });
+        return end + 1;
+    }
+
+    /// A property, as its getter and, unless it is `readonly`, its setter.
+    fn property(p: *Parser, start: usize, c: ?*Container) !usize {
+        var end = start + 1;
+        while (!eql(try p.at(end), ";")) end += 1;
+        const container_ = c orelse return end + 1;
+        const tokens = p.texts[start + 1 .. end];
+        const m = try withoutMarkers(p.arena, tokens);
+
+        var attributes: []const []const u8 = &.{};
+        var k: usize = 0;
+        if (m.len > 0 and eql(m[0], "(")) {
+            const close = try closing(m, 0);
+            attributes = m[1..close];
+            k = close + 1;
+        }
+        // The name of a block or function pointer property is inside the
+        // parentheses: `void (^handler)(NSArray<id<MTLBuffer>> *)`.
+        var typ = try withoutAngles(p.arena, m[k..]);
+        var name: []const u8 = undefined;
+        if (indexOf(typ, "(")) |paren| {
+            if (paren + 2 >= typ.len) return error.UnexpectedToken;
+            name = typ[paren + 2];
+            typ = try concat(p.arena, typ[0 .. paren + 2], typ[paren + 3 ..]);
+        } else {
+            if (m.len - k < 2) return error.UnexpectedToken;
+            name = m[m.len - 1];
+            typ = m[k .. m.len - 1];
+        }
+
+        var getter = name;
+        var setter = try std.fmt.allocPrint(p.arena, "set{c}{s}:", .{ std.ascii.toUpper(name[0]), name[1..] });
+        var readonly = false;
+        var is_class = false;
+        var a: usize = 0;
+        while (a < attributes.len) : (a += 1) {
+            const t = attributes[a];
+            if (eql(t, "getter") and a + 2 < attributes.len) {
+                getter = attributes[a + 2];
+                a += 2;
+            } else if (eql(t, "setter") and a + 2 < attributes.len) {
+                setter = try std.fmt.allocPrint(p.arena, "{s}:", .{attributes[a + 2]});
+                a += 3;
+            } else if (eql(t, "readonly")) {
+                readonly = true;
+            } else if (eql(t, "class")) {
+                is_class = true;
+            }
+        }
+
+        const unavailable = contains(tokens, unavailable_marker);
+        try container_.methods.append(p.arena, .{
+            .selector = getter,
+            .result = typ,
+            .params = &.{},
+            .is_class = is_class,
+            .unavailable = unavailable,
+        });
+        if (!readonly) {
+            try container_.methods.append(p.arena, .{
+                .selector = setter,
+                .result = &.{"void"},
+                .params = try p.arena.dupe(Param, &.{.{ .name = name, .type = typ }}),
+                .is_class = is_class,
+                .unavailable = unavailable,
+            });
+        }
+        return end + 1;
+    }
+};
+
+/// What a C type maps to.
+const Resolved = struct {
+    kind: Kind,
+    /// The Zig type, for scalars, structs and pointers.
+    zig: []const u8 = "",
+    /// The C integer or float type a scalar is in the end, e.g. `c_ulong`
+    /// for `NSUInteger`.
+    builtin: []const u8 = "",
+
+    const Kind = enum {
+        object,
+        class,
+        selector,
+        boolean,
+        void,
+        scalar,
+        @"struct",
+        pointer,
+        /// A type that only a pointer can refer to, like a union.
+        incomplete,
+    };
+
+    /// The Zig type in a struct field or a `msgSend` return type.
+    fn field(r: Resolved) []const u8 {
+        return switch (r.kind) {
+            .object => "?objc.id",
+            .class => "?objc.Class",
+            .selector => "?objc.SEL",
+            .boolean => "objc.BOOL",
+            .void => "void",
+            else => r.zig,
+        };
+    }
+
+    /// The Zig type in a wrapper's signature.
+    fn param(r: Resolved) []const u8 {
+        return if (r.kind == .boolean) "bool" else r.field();
+    }
+};
+
+const scalar_c_int: Resolved = .{ .kind = .scalar, .zig = "c_int", .builtin = "c_int" };
+
+const Emitter = struct {
+    arena: std.mem.Allocator,
+    parser: *const Parser,
+    /// The top-level declarations, by C name.
+    decls: std.StringHashMapUnmanaged([]const u8) = .{},
+    typedef_states: std.StringHashMapUnmanaged(?Resolved) = .{},
+    /// The first typedef of each enum tag, the type of its constants.
+    enum_typedefs: std.StringHashMapUnmanaged([]const u8) = .{},
+    emitted: usize = 0,
+    skipped: usize = 0,
+
+    fn init(arena: std.mem.Allocator, parser: *const Parser) !Emitter {
+        var e: Emitter = .{ .arena = arena, .parser = parser };
+        var it = parser.typedefs.iterator();
+        while (it.next()) |entry| {
+            const typ = entry.value_ptr.*;
+            if (typ.len == 2 and eql(typ[0], "struct")) {
+                if (parser.struct_tags.get(typ[1])) |s| {
+                    if (s.name == null) s.name = entry.key_ptr.*;
+                }
+            }
+            if (typ.len >= 2 and eql(typ[0], "enum")) {
+                const tag = try e.enum_typedefs.getOrPut(arena, typ[1]);
+                if (!tag.found_existing) tag.value_ptr.* = entry.key_ptr.*;
+            }
+        }
+        return e;
+    }
+
+    fn id(e: *const Emitter, name: []const u8) ![]const u8 {
+        return std.fmt.allocPrint(e.arena, "{}", .{std.zig.fmtId(name)});
+    }
+
+    /// Resolves a typedef once. Scalars and structs are declared under the
+    /// typedef's name and referred to by it.
+    fn typedef(e: *Emitter, name: []const u8) !?Resolved {
+        if (e.typedef_states.get(name)) |state| return state;
+        // Null until resolved, which also ends cycles.
+        try e.typedef_states.put(e.arena, name, null);
+        var result = try e.resolve(e.parser.typedefs.get(name).?, null) orelse return null;
+        const zig_name = try e.id(name);
+        switch (result.kind) {
+            .scalar => {
+                try e.decls.put(e.arena, name, try std.fmt.allocPrint(e.arena, "pub const {s} = {s};", .{ zig_name, result.zig }));
+                result.zig = zig_name;
+            },
+            .@"struct" => if (!eql(result.zig, zig_name)) {
+                try e.decls.put(e.arena, name, try std.fmt.allocPrint(e.arena, "pub const {s} = {s};", .{ zig_name, result.zig }));
+                result.zig = zig_name;
+            },
+            else => {},
+        }
+        try e.typedef_states.put(e.arena, name, result);
+        return result;
+    }
+
+    /// Declares a struct as an `extern struct` and returns its Zig name,
+    /// or null if a field has no Zig equivalent.
+    fn structName(e: *Emitter, s: *Struct) !?[]const u8 {
+        switch (s.state) {
+            .done => return try e.id(s.name.?),
+            .visiting, .failed => return null,
+            .unvisited => {},
+        }
+        s.state = .failed;
+        if (s.layout) return null;
+        const name = s.name orelse try std.fmt.allocPrint(e.arena, "struct_{s}", .{s.tag});
+        s.name = name;
+        s.state = .visiting;
+        errdefer s.state = .failed;
+
+        var fields = std.ArrayList(u8).init(e.arena);
+        for (try splitTopLevel(e.arena, s.body, ";")) |raw| {
+            const d = try without(e.arena, raw, unavailable_marker);
+            if (d.len == 0) continue;
+            if (contains(d, "{") or contains(d, ":") or contains(d, "(") or contains(d, layout_marker)) {
+                s.state = .failed;
+                return null;
+            }
+            var spec: []const []const u8 = &.{};
+            for (try splitTopLevel(e.arena, d, ","), 0..) |part, n| {
+                var declarator = part;
+                var array: ?[]const u8 = null;
+                if (indexOf(declarator, "[")) |bracket| {
+                    if (declarator.len != bracket + 3 or !eql(declarator[bracket + 2], "]") or !isDigits(declarator[bracket + 1])) {
+                        s.state = .failed;
+                        return null;
+                    }
+                    array = declarator[bracket + 1];
+                    declarator = declarator[0..bracket];
+                }
+                if (declarator.len < @as(usize, if (n == 0) 2 else 1) or !isIdent(declarator[declarator.len - 1])) {
+                    s.state = .failed;
+                    return null;
+                }
+                const typ = if (n == 0) declarator[0 .. declarator.len - 1] else try concat(e.arena, spec, declarator[0 .. declarator.len - 1]);
+                if (n == 0) spec = try without(e.arena, typ, "*");
+                const r = try e.resolve(typ, null) orelse {
+                    s.state = .failed;
+                    return null;
+                };
+                if (r.kind == .void) {
+                    s.state = .failed;
+                    return null;
+                }
+                try fields.writer().print("    {s}: ", .{try e.id(declarator[declarator.len - 1])});
+                if (array) |len| try fields.writer().print("[{s}]", .{len});
+                try fields.writer().print("{s},\n", .{r.field()});
+            }
+        }
+        if (fields.items.len == 0) {
+            s.state = .failed;
+            return null;
+        }
+        s.state = .done;
+        const zig_name = try e.id(name);
+        try e.decls.put(e.arena, name, try std.fmt.allocPrint(e.arena, "pub const {s} = extern struct {{\n{s}}};", .{ zig_name, fields.items }));
+        return zig_name;
+    }
+
+    /// Maps a C type to Zig, or returns null if there is no equivalent.
+    /// `generics` are the type parameters in scope.
+    fn resolve(e: *Emitter, typ: []const []const u8, generics: ?*const Container) !?Resolved {
+        var tokens = std.ArrayList([]const u8).init(e.arena);
+        var k: usize = 0;
+        while (k < typ.len) : (k += 1) {
+            if (eql(typ[k], "<")) {
+                k = (skipAngles(typ, k) catch return null) - 1;
+                continue;
+            }
+            if (!isQualifier(typ[k])) try tokens.append(typ[k]);
+        }
+        const t = tokens.items;
+        if (contains(t, "^") or contains(t, "(")) return .{ .kind = .pointer, .zig = "?*const anyopaque" };
+        if (contains(t, "[") or contains(t, layout_marker)) return null;
+
+        var stars: usize = 0;
+        var is_const = false;
+        var base = std.ArrayList([]const u8).init(e.arena);
+        for (t) |token| {
+            if (eql(token, "*")) {
+                stars += 1;
+            } else if (eql(token, "const")) {
+                is_const = true;
+            } else {
+                try base.append(token);
+            }
+        }
+        if (base.items.len == 0) return null;
+        const r = try e.baseType(base.items, generics);
+        if (stars == 0) {
+            if (r != null and r.?.kind == .incomplete) return null;
+            return r;
+        }
+
+        const opaque_pointer: Resolved = .{
+            .kind = .pointer,
+            .zig = if (is_const and stars == 1) "?*const anyopaque" else "?*anyopaque",
+        };
+        const pointee = r orelse return opaque_pointer;
+        switch (pointee.kind) {
+            .object => return switch (stars) {
+                1 => pointee,
+                2 => .{ .kind = .pointer, .zig = "?*?objc.id" },
+                else => opaque_pointer,
+            },
+            .scalar, .@"struct", .boolean => {},
+            else => return opaque_pointer,
+        }
+        var zig = std.ArrayList(u8).init(e.arena);
+        for (1..stars) |_| try zig.appendSlice("[*c]");
+        try zig.appendSlice(if (is_const) "[*c]const " else "[*c]");
+        try zig.appendSlice(pointee.field());
+        return .{ .kind = .pointer, .zig = zig.items };
+    }
+
+    fn baseType(e: *Emitter, tokens: []const []const u8, generics: ?*const Container) !?Resolved {
+        const p = e.parser;
+        if (tokens.len == 1) {
+            const t = tokens[0];
+            if (eql(t, "id") or eql(t, "instancetype")) return .{ .kind = .object };
+            if (generics) |g| if (g.generics.contains(t)) return .{ .kind = .object };
+            if (eql(t, "Class")) return .{ .kind = .class };
+            if (eql(t, "SEL")) return .{ .kind = .selector };
+            if (eql(t, "BOOL")) return .{ .kind = .boolean };
+            if (eql(t, "void")) return .{ .kind = .void };
+            if (p.typedefs.contains(t)) return e.typedef(t);
+            if (p.classes.contains(t)) return .{ .kind = .object };
+        }
+        if (builtinType(tokens)) |b| return .{ .kind = .scalar, .zig = b, .builtin = b };
+        if (eql(tokens[0], "struct") and tokens.len == 2) {
+            const s = p.struct_tags.get(tokens[1]) orelse return .{ .kind = .incomplete };
+            const name = try e.structName(s) orelse return .{ .kind = .incomplete };
+            return .{ .kind = .@"struct", .zig = name };
+        }
+        if (eql(tokens[0], "enum") and tokens.len >= 2) {
+            var fixed: ?[]const []const u8 = if (indexOf(tokens, ":")) |colon| tokens[colon + 1 ..] else null;
+            if (fixed == null) {
+                if (p.enum_tags.get(tokens[1])) |en| fixed = en.fixed;
+            }
+            return if (fixed) |f| e.resolve(f, null) else scalar_c_int;
+        }
+        if (eql(tokens[0], "union")) return .{ .kind = .incomplete };
+        return null;
+    }
+
+    /// Declares the constants of the enums in the selected frameworks, as
+    /// the enum's typedef or, failing that, its underlying type.
+    fn constants(e: *Emitter) !void {
+        var values: std.StringHashMapUnmanaged(i128) = .{};
+        for (e.parser.enums.items) |en| {
+            const body = en.body orelse continue;
+            var constant_type: ?Resolved = null;
+            if (en.selected) {
+                const r = if (e.enum_typedefs.get(en.tag)) |name|
+                    try e.typedef(name)
+                else if (en.fixed) |f|
+                    try e.resolve(f, null)
+                else
+                    scalar_c_int;
+                if (r) |x| {
+                    if (x.kind == .scalar and limits(x.builtin) != null) constant_type = x;
+                }
+            }
+            var next: ?i128 = 0;
+            for (try splitTopLevel(e.arena, body, ",")) |raw| {
+                const item = try withoutMarkers(e.arena, raw);
+                if (item.len == 0) continue;
+                const name = item[0];
+                const value = if (item.len > 1 and eql(item[1], "="))
+                    evaluate(item[2..], &values, &e.parser.typedefs)
+                else
+                    next;
+                const v = value orelse {
+                    next = null;
+                    continue;
+                };
+                try values.put(e.arena, name, v);
+                next = std.math.add(i128, v, 1) catch null;
+                const t = constant_type orelse continue;
+                const range = limits(t.builtin).?;
+                if (v < range.min or v > range.max or e.decls.contains(name)) continue;
+                try e.decls.put(e.arena, name, try std.fmt.allocPrint(e.arena, "pub const {s}: {s} = {d};", .{ try e.id(name), t.zig, v }));
+            }
+        }
+    }
+
+    /// The wrappers of one container, or an empty string if it has none.
+    fn container(
+        e: *Emitter,
+        c: *const Container,
+        top: *const std.StringHashMapUnmanaged(void),
+        imp_cache: bool,
+    ) ![]const u8 {
+        // Instance methods win over class methods of the same name, as
+        // `NSObject` declares both `-description` and `+description`.
+        var methods: std.StringArrayHashMapUnmanaged(Method) = .{};
+        for (c.methods.items) |m| {
+            if (m.unavailable) continue;
+            const name = try e.arena.dupe(u8, m.selector);
+            std.mem.replaceScalar(u8, name, ':', '_');
+            const entry = try methods.getOrPut(e.arena, name);
+            if (entry.found_existing and (m.is_class or !entry.value_ptr.is_class)) continue;
+            entry.value_ptr.* = m;
+        }
+        const names = try sortedKeys(e.arena, methods.keys());
+
+        var body = std.ArrayList(u8).init(e.arena);
+        var cached = std.ArrayList(u8).init(e.arena);
+        for (names) |name| {
+            const m = methods.get(name).?;
+            const result = try e.resolve(m.result, c) orelse {
+                e.skipped += 1;
+                continue;
+            };
+            const params = try e.arena.alloc(Resolved, m.params.len);
+            for (m.params, params) |param, *r| {
+                r.* = try e.resolve(try decay(e.arena, param.type), c) orelse break;
+                if (r.kind == .void) break;
+            } else {
+                try e.method(&body, &cached, name, m, result, params, &methods, top, imp_cache);
+                e.emitted += 1;
+                continue;
+            }
+            e.skipped += 1;
+        }
+        if (body.items.len == 0) return "";
+        var out = std.ArrayList(u8).init(e.arena);
+        const writer = out.writer();
+        try writer.print("pub const {s} = struct {{\n{s}", .{ try e.id(c.name), body.items });
+        if (imp_cache) try writer.print("\n    pub const Cached = struct {{\n{s}    }};\n", .{cached.items});
+        try writer.writeAll("};\n\n");
+        return out.items;
+    }
+
+    fn method(
+        e: *Emitter,
+        body: *std.ArrayList(u8),
+        cached: *std.ArrayList(u8),
+        name: []const u8,
+        m: Method,
+        result: Resolved,
+        params: []const Resolved,
+        methods: *const std.StringArrayHashMapUnmanaged(Method),
+        top: *const std.StringHashMapUnmanaged(void),
+        imp_cache: bool,
+    ) !void {
+        var scope: Scope = .{ .top = top, .methods = methods };
+        const receiver = try e.id(try scope.unique(e.arena, "self"));
+        var signature = std.ArrayList(u8).init(e.arena);
+        var args = std.ArrayList(u8).init(e.arena);
+        try signature.writer().print("{s}: {s}", .{ receiver, if (m.is_class) "objc.Class" else "objc.id" });
+        for (m.params, params, 0..) |param, r, n| {
+            const param_name = try e.id(try scope.unique(e.arena, param.name));
+            try signature.writer().print(", {s}: {s}", .{ param_name, r.param() });
+            if (n > 0) try args.appendSlice(", ");
+            if (r.kind == .boolean) {
+                try args.writer().print("if ({s}) objc.YES else objc.NO", .{param_name});
+            } else {
+                try args.appendSlice(param_name);
+            }
+        }
+        const tuple = if (args.items.len == 0) ".{}" else try std.fmt.allocPrint(e.arena, ".{{ {s} }}", .{args.items});
+        const compare = if (result.kind == .boolean) " != objc.NO" else "";
+        const fn_name = try e.id(name);
+
+        try body.writer().print(
+            \\    pub inline fn {s}({s}) {s} {{
+            \\        return objc.msgSend({s}, {s}, "{s}", {s}){s};
+            \\    }}
+            \\
+        , .{ fn_name, signature.items, result.param(), result.field(), receiver, m.selector, tuple, compare });
+        if (!imp_cache) return;
+        const cache = try e.id(try scope.unique(e.arena, "cache"));
+        try cached.writer().print(
+            \\        pub inline fn {s}({s}: *objc.Cache, {s}) {s} {{
+            \\            return {s}.send({s}, {s}, "{s}", {s}){s};
+            \\        }}
+            \\
+        , .{ fn_name, cache, signature.items, result.param(), cache, result.field(), receiver, m.selector, tuple, compare });
+    }
+
+    fn emit(e: *Emitter, frameworks: []const []const u8, imp_cache: bool) ![]const u8 {
+        try e.constants();
+        var top: std.StringHashMapUnmanaged(void) = .{};
+        try top.put(e.arena, "objc", {});
+        if (imp_cache) try top.put(e.arena, "Cached", {});
+        for (e.parser.containers.keys()) |name| try top.put(e.arena, name, {});
+        for (e.parser.typedefs.keys()) |name| try top.put(e.arena, name, {});
+        var decl_names = e.decls.keyIterator();
+        while (decl_names.next()) |name| try top.put(e.arena, name.*, {});
+
+        var containers = std.ArrayList(u8).init(e.arena);
+        for (try sortedKeys(e.arena, e.parser.containers.keys())) |name| {
+            try containers.appendSlice(try e.container(e.parser.containers.get(name).?, &top, imp_cache));
+        }
+
+        var names = std.ArrayList([]const u8).init(e.arena);
+        var it = e.decls.keyIterator();
+        while (it.next()) |name| try names.append(name.*);
+
+        var out = std.ArrayList(u8).init(e.arena);
+        const writer = out.writer();
+        try writer.writeAll("//! Typed message sends for the Objective-C classes and protocols of\n//! ");
+        for (frameworks, 0..) |name, n| {
+            try writer.print("{s}{s}", .{ if (n == 0) "" else ", ", name });
+        }
+        try writer.print(
+            \\. Generated by objc_shims from the SDK
+            \\//! headers: {d} methods. {d} more have types without a Zig equivalent and
+            \\//! are left out.
+            \\
+            \\const objc = @import("objc");
+            \\
+            \\
+        , .{ e.emitted, e.skipped });
+        try writer.writeAll(containers.items);
+        for (try sortedKeys(e.arena, names.items)) |name| try writer.print("{s}\n", .{e.decls.get(name).?});
+        return out.items;
+    }
+};
+
+/// The names a wrapper's parameters must not shadow: the top-level
+/// declarations, the functions of its struct and the other parameters.
+const Scope = struct {
+    top: *const std.StringHashMapUnmanaged(void),
+    methods: *const std.StringArrayHashMapUnmanaged(Method),
+    params: std.StringHashMapUnmanaged(void) = .{},
+
+    /// Appends underscores to `name` until it is free, and takes it.
+    fn unique(scope: *Scope, arena: std.mem.Allocator, name: []const u8) ![]const u8 {
+        var result = name;
+        while (scope.top.contains(result) or scope.methods.contains(result) or scope.params.contains(result)) {
+            result = try std.fmt.allocPrint(arena, "{s}_", .{result});
+        }
+        try scope.params.put(arena, result, {});
+        return result;
+    }
+};
+
+/// Turns an array parameter, `const CGFloat components[]`, into a pointer.
+fn decay(arena: std.mem.Allocator, typ: []const []const u8) ![]const []const u8 {
+    const bracket = indexOf(typ, "[") orelse return typ;
+    return concat(arena, typ[0..bracket], &.{"*"});
+}
+
+/// Evaluates an enumerator's value: integer and character literals, earlier
+/// enumerators, casts, and the unary and bitwise operators, shifts, `+`,
+/// `-` and `*`. Returns null for anything else or on overflow.
+fn evaluate(
+    tokens: []const []const u8,
+    values: *const std.StringHashMapUnmanaged(i128),
+    typedefs: *const std.StringArrayHashMapUnmanaged([]const []const u8),
+) ?i128 {
+    var evaluator: Evaluator = .{ .tokens = tokens, .values = values, .typedefs = typedefs };
+    const value = evaluator.bitOr() catch return null;
+    if (evaluator.i != tokens.len) return null;
+    return value;
+}
+
+const Evaluator = struct {
+    tokens: []const []const u8,
+    i: usize = 0,
+    values: *const std.StringHashMapUnmanaged(i128),
+    typedefs: *const std.StringArrayHashMapUnmanaged([]const []const u8),
+
+    const Error = error{ Invalid, Overflow };
+
+    fn peek(v: *const Evaluator, offset: usize) []const u8 {
+        return if (v.i + offset < v.tokens.len) v.tokens[v.i + offset] else "";
+    }
+
+    fn bitOr(v: *Evaluator) Error!i128 {
+        var a = try v.bitXor();
+        while (eql(v.peek(0), "|")) {
+            v.i += 1;
+            a |= try v.bitXor();
+        }
+        return a;
+    }
+
+    fn bitXor(v: *Evaluator) Error!i128 {
+        var a = try v.bitAnd();
+        while (eql(v.peek(0), "^")) {
+            v.i += 1;
+            a ^= try v.bitAnd();
+        }
+        return a;
+    }
+
+    fn bitAnd(v: *Evaluator) Error!i128 {
+        var a = try v.shift();
+        while (eql(v.peek(0), "&")) {
+            v.i += 1;
+            a &= try v.shift();
+        }
+        return a;
+    }
+
+    fn shift(v: *Evaluator) Error!i128 {
+        var a = try v.additive();
+        while ((eql(v.peek(0), "<") or eql(v.peek(0), ">")) and eql(v.peek(1), v.peek(0))) {
+            const left = eql(v.peek(0), "<");
+            v.i += 2;
+            const b = try v.additive();
+            if (b < 0 or b > 127) return error.Invalid;
+            const amount: u7 = @intCast(b);
+            a = if (left) try std.math.shlExact(i128, a, amount) else a >> amount;
+        }
+        return a;
+    }
+
+    fn additive(v: *Evaluator) Error!i128 {
+        var a = try v.multiplicative();
+        while (eql(v.peek(0), "+") or eql(v.peek(0), "-")) {
+            const add = eql(v.peek(0), "+");
+            v.i += 1;
+            const b = try v.multiplicative();
+            a = if (add) try std.math.add(i128, a, b) else try std.math.sub(i128, a, b);
+        }
+        return a;
+    }
+
+    fn multiplicative(v: *Evaluator) Error!i128 {
+        var a = try v.unary();
+        while (eql(v.peek(0), "*")) {
+            v.i += 1;
+            a = try std.math.mul(i128, a, try v.unary());
+        }
+        return a;
+    }
+
+    fn unary(v: *Evaluator) Error!i128 {
+        const t = v.peek(0);
+        if (t.len == 0) return error.Invalid;
+        if (eql(t, "-")) {
+            v.i += 1;
+            return std.math.sub(i128, 0, try v.unary());
+        }
+        if (eql(t, "+")) {
+            v.i += 1;
+            return v.unary();
+        }
+        if (eql(t, "~")) {
+            v.i += 1;
+            return ~try v.unary();
+        }
+        if (eql(t, "(")) {
+            // A cast, `(NSUInteger)1 << 3`, or a parenthesized expression.
+            var j = v.i + 1;
+            while (j < v.tokens.len and v.isTypeName(v.tokens[j])) j += 1;
+            if (j > v.i + 1 and j < v.tokens.len and eql(v.tokens[j], ")")) {
+                v.i = j + 1;
+                return v.unary();
+            }
+            v.i += 1;
+            const a = try v.bitOr();
+            if (!eql(v.peek(0), ")")) return error.Invalid;
+            v.i += 1;
+            return a;
+        }
+        v.i += 1;
+        if (std.ascii.isDigit(t[0])) return intLiteral(t);
+        if (t[0] == '\'') return charLiteral(t);
+        return v.values.get(t) orelse error.Invalid;
+    }
+
+    fn isTypeName(v: *const Evaluator, t: []const u8) bool {
+        const keywords = [_][]const u8{ "unsigned", "signed", "long", "short", "int", "char", "void" };
+        for (keywords) |keyword| {
+            if (eql(t, keyword)) return true;
+        }
+        return v.typedefs.contains(t) or builtinType(&.{t}) != null;
+    }
+};
+
+fn intLiteral(token: []const u8) Evaluator.Error!i128 {
+    const digits = std.mem.trimRight(u8, token, "uUlL");
+    if (std.mem.startsWith(u8, digits, "0x") or std.mem.startsWith(u8, digits, "0X")) {
+        return std.fmt.parseInt(i128, digits[2..], 16) catch error.Invalid;
+    }
+    if (digits.len > 1 and digits[0] == '0') return std.fmt.parseInt(i128, digits[1..], 8) catch error.Invalid;
+    return std.fmt.parseInt(i128, digits, 10) catch error.Invalid;
+}
+
+/// `'a'` or a four character code such as `'MTLb'`.
+fn charLiteral(token: []const u8) Evaluator.Error!i128 {
+    if (token.len < 3 or token[token.len - 1] != '\'') return error.Invalid;
+    const chars = token[1 .. token.len - 1];
+    if (chars.len > 8 or std.mem.indexOfScalar(u8, chars, '\\') != null) return error.Invalid;
+    var value: i128 = 0;
+    for (chars) |c| value = value << 8 | c;
+    return value;
+}
+
+/// The Zig type of a C arithmetic type such as `unsigned long`.
+fn builtinType(tokens: []const []const u8) ?[]const u8 {
+    var signed = false;
+    var unsigned = false;
+    var short = false;
+    var long: u2 = 0;
+    var int = false;
+    var char = false;
+    var float = false;
+    var double = false;
+    var boolean = false;
+    for (tokens) |t| {
+        if (eql(t, "signed") and !signed and !unsigned) {
+            signed = true;
+        } else if (eql(t, "unsigned") and !signed and !unsigned) {
+            unsigned = true;
+        } else if (eql(t, "short") and !short) {
+            short = true;
+        } else if (eql(t, "long") and long < 2) {
+            long += 1;
+        } else if (eql(t, "int") and !int) {
+            int = true;
+        } else if (eql(t, "char") and !char) {
+            char = true;
+        } else if (eql(t, "float") and !float) {
+            float = true;
+        } else if (eql(t, "double") and !double) {
+            double = true;
+        } else if ((eql(t, "_Bool") or eql(t, "bool")) and !boolean) {
+            boolean = true;
+        } else {
+            return null;
+        }
+    }
+    if (boolean) return if (tokens.len == 1) "bool" else null;
+    if (float) return if (tokens.len == 1) "f32" else null;
+    if (double) {
+        if (tokens.len == 1) return "f64";
+        return if (tokens.len == 2 and long == 1) "c_longdouble" else null;
+    }
+    if (char) {
+        if (short or long > 0 or int) return null;
+        return if (signed) "i8" else "u8";
+    }
+    if (short) {
+        if (long > 0) return null;
+        return if (unsigned) "c_ushort" else "c_short";
+    }
+    if (long == 1) return if (unsigned) "c_ulong" else "c_long";
+    if (long == 2) return if (unsigned) "c_ulonglong" else "c_longlong";
+    if (int or signed or unsigned) return if (unsigned) "c_uint" else "c_int";
+    return null;
+}
+
+const Limits = struct { min: i128, max: i128 };
+
+/// The range of an integer type on both macOS architectures.
+fn limits(builtin: []const u8) ?Limits {
+    const table = [_]struct { []const u8, type }{
+        .{ "u8", u8 },
+        .{ "i8", i8 },
+        .{ "c_short", i16 },
+        .{ "c_ushort", u16 },
+        .{ "c_int", i32 },
+        .{ "c_uint", u32 },
+        .{ "c_long", i64 },
+        .{ "c_ulong", u64 },
+        .{ "c_longlong", i64 },
+        .{ "c_ulonglong", u64 },
+    };
+    inline for (table) |entry| {
+        if (eql(builtin, entry[0])) return .{ .min = std.math.minInt(entry[1]), .max = std.math.maxInt(entry[1]) };
+    }
+    return null;
+}
+
+/// Nullability, ownership and other qualifiers that do not change how a
+/// type is passed. `const` is kept; it matters behind a pointer.
+fn isQualifier(t: []const u8) bool {
+    const qualifiers = [_][]const u8{
+        "_Nullable",
+        "_Nonnull",
+        "_Null_unspecified",
+        "_Nullable_result",
+        "__nullable",
+        "__nonnull",
+        "__null_unspecified",
+        "nullable",
+        "nonnull",
+        "null_unspecified",
+        "null_resettable",
+        "__kindof",
+        "__strong",
+        "__weak",
+        "__unsafe_unretained",
+        "__autoreleasing",
+        "__block",
+        "oneway",
+        "in",
+        "out",
+        "inout",
+        "bycopy",
+        "byref",
+        "volatile",
+        "restrict",
+        "__restrict",
+        "__restrict__",
+        "_Atomic",
+        "__covariant",
+        "__contravariant",
+        "static",
+        "extern",
+        "inline",
+        "__inline",
+        "__inline__",
+        "register",
+        "__single",
+        "__indexable",
+        "__bidi_indexable",
+        "__unsafe_indexable",
+    };
+    for (qualifiers) |q| {
+        if (eql(t, q)) return true;
+    }
+    return false;
+}
+
+fn isTagKeyword(t: []const u8) bool {
+    return eql(t, "struct") or eql(t, "union") or eql(t, "enum");
+}
+
+fn isMarker(t: []const u8) bool {
+    return eql(t, unavailable_marker) or eql(t, layout_marker);
+}
+
+fn isOpen(t: []const u8) bool {
+    return eql(t, "(") or eql(t, "{") or eql(t, "[");
+}
+
+fn isClose(t: []const u8) bool {
+    return eql(t, ")") or eql(t, "}") or eql(t, "]");
+}
+
+fn isIdentStart(c: u8) bool {
+    return std.ascii.isAlphabetic(c) or c == '_' or c == '$';
+}
+
+fn isIdentChar(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '_' or c == '$';
+}
+
+fn isIdent(t: []const u8) bool {
+    return t.len > 0 and isIdentStart(t[0]);
+}
+
+fn isDigits(t: []const u8) bool {
+    if (t.len == 0) return false;
+    for (t) |c| {
+        if (!std.ascii.isDigit(c)) return false;
+    }
+    return true;
+}
+
+/// The index of the bracket that closes the one at `open`.
+fn closing(tokens: []const []const u8, open: usize) !usize {
+    var depth: usize = 0;
+    for (tokens[open..], open..) |t, i| {
+        if (isOpen(t)) {
+            depth += 1;
+        } else if (isClose(t)) {
+            depth -= 1;
+            if (depth == 0) return i;
+        }
+    }
+    return error.UnbalancedBrackets;
+}
+
+/// The index after the `>` that closes the `<` at `open`.
+fn skipAngles(tokens: []const []const u8, open: usize) !usize {
+    var depth: usize = 0;
+    for (tokens[open..], open..) |t, i| {
+        if (eql(t, "<")) {
+            depth += 1;
+        } else if (eql(t, ">")) {
+            depth -= 1;
+            if (depth == 0) return i + 1;
+        }
+    }
+    return error.UnbalancedBrackets;
+}
+
+/// Splits `tokens` at each `separator` outside brackets. Tokens after the
+/// last separator form a part of their own unless the separator is `;`.
+fn splitTopLevel(arena: std.mem.Allocator, tokens: []const []const u8, separator: []const u8) ![]const []const []const u8 {
+    var parts = std.ArrayList([]const []const u8).init(arena);
+    var depth: usize = 0;
+    var start: usize = 0;
+    for (tokens, 0..) |t, i| {
+        if (isOpen(t)) {
+            depth += 1;
+        } else if (isClose(t)) {
+            depth -|= 1;
+        } else if (depth == 0 and eql(t, separator)) {
+            try parts.append(tokens[start..i]);
+            start = i + 1;
+        }
+    }
+    if (!eql(separator, ";")) try parts.append(tokens[start..]);
+    return parts.items;
+}
+
+fn withoutAngles(arena: std.mem.Allocator, tokens: []const []const u8) ![]const []const u8 {
+    var out = std.ArrayList([]const u8).init(arena);
+    var depth: usize = 0;
+    for (tokens) |t| {
+        if (eql(t, "<")) {
+            depth += 1;
+        } else if (eql(t, ">")) {
+            depth -|= 1;
+        } else if (depth == 0) {
+            try out.append(t);
+        }
+    }
+    return out.items;
+}
+
+fn without(arena: std.mem.Allocator, tokens: []const []const u8, token: []const u8) ![]const []const u8 {
+    var out = std.ArrayList([]const u8).init(arena);
+    for (tokens) |t| {
+        if (!eql(t, token)) try out.append(t);
+    }
+    return out.items;
+}
+
+fn withoutMarkers(arena: std.mem.Allocator, tokens: []const []const u8) ![]const []const u8 {
+    var out = std.ArrayList([]const u8).init(arena);
+    for (tokens) |t| {
+        if (!isMarker(t)) try out.append(t);
+    }
+    return out.items;
+}
+
+fn concat(arena: std.mem.Allocator, a: []const []const u8, b: []const []const u8) ![]const []const u8 {
+    return std.mem.concat(arena, []const u8, &.{ a, b });
+}
+
+fn indexOf(tokens: []const []const u8, token: []const u8) ?usize {
+    for (tokens, 0..) |t, i| {
+        if (eql(t, token)) return i;
+    }
+    return null;
+}
+
+fn contains(tokens: []const []const u8, token: []const u8) bool {
+    return indexOf(tokens, token) != null;
+}
+
+fn sortedKeys(arena: std.mem.Allocator, keys: []const []const u8) ![]const []const u8 {
+    const copy = try arena.dupe([]const u8, keys);
+    std.mem.sort([]const u8, copy, {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+    return copy;
+}
+
+fn eql(a: []const u8, b: []const u8) bool {
+    return std.mem.eql(u8, a, b);
+}
+
+/// The tokens of `text`, which has no line markers.
+fn testTokens(arena: std.mem.Allocator, text: []const u8) ![]const []const u8 {
+    return (try stripAttributes(arena, try tokenize(arena, text, &.{}))).items(.text);
+}
+
+test "evaluate folds enumerator values" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    var values: std.StringHashMapUnmanaged(i128) = .{};
+    try values.put(arena, "NSWindowStyleMaskTitled", 1);
+    try values.put(arena, "NSWindowStyleMaskResizable", 8);
+    var typedefs: std.StringArrayHashMapUnmanaged([]const []const u8) = .{};
+    try typedefs.put(arena, "NSUInteger", &.{ "unsigned", "long" });
+
+    const cases = [_]struct { []const u8, ?i128 }{
+        .{ "1 << 3", 8 },
+        .{ "(NSUInteger)1 << 63", 1 << 63 },
+        .{ "(unsigned long long)-1", -1 },
+        .{ "NSWindowStyleMaskTitled | NSWindowStyleMaskResizable", 9 },
+        .{ "~0 ^ 0x0F & 0x3", -4 },
+        .{ "-(1 + 2) * 4 - +1", -13 },
+        .{ "(1 << 4) >> 2", 4 },
+        .{ "'MTLb'", 0x4d544c62 },
+        .{ "0x10UL", 16 },
+        // Not folded: unknown names, division, a dangling operator,
+        // shifts out of range.
+        .{ "NSWindowStyleMaskMiniaturizable", null },
+        .{ "8 / 2", null },
+        .{ "1 |", null },
+        .{ "1 << 128", null },
+        .{ "1 << 127", null },
+    };
+    for (cases) |case| {
+        const value = evaluate(try testTokens(arena, case[0]), &values, &typedefs);
+        std.testing.expectEqual(case[1], value) catch |err| {
+            std.debug.print("evaluate({s})\n", .{case[0]});
+            return err;
+        };
+    }
+}
+
+test "intLiteral and charLiteral" {
+    try std.testing.expectEqual(31, try intLiteral("0x1FUL"));
+    try std.testing.expectEqual(31, try intLiteral("0X1f"));
+    try std.testing.expectEqual(15, try intLiteral("017"));
+    try std.testing.expectEqual(0, try intLiteral("0"));
+    try std.testing.expectEqual(42, try intLiteral("42ull"));
+    try std.testing.expectError(error.Invalid, intLiteral("08"));
+    try std.testing.expectError(error.Invalid, intLiteral("1.5"));
+
+    try std.testing.expectEqual('a', try charLiteral("'a'"));
+    try std.testing.expectEqual(0x4d544c62, try charLiteral("'MTLb'"));
+    try std.testing.expectError(error.Invalid, charLiteral("'\\n'"));
+    try std.testing.expectError(error.Invalid, charLiteral("'abcdefghi'"));
+    try std.testing.expectError(error.Invalid, charLiteral("'a"));
+}
+
+test "resolve maps C types to Zig" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    // As NS_ENUM, NS_OPTIONS and the SDK's typedefs expand.
+    const source =
+        \\typedef unsigned long NSUInteger;
+        \\typedef bool BOOL;
+        \\typedef struct CGPoint { double x; double y; } CGPoint;
+        \\struct __attribute__((packed)) Packed { char c; int i; };
+        \\typedef void (^MTLCommandBufferHandler)(id);
+        \\typedef int (*CFComparatorFunction)(const void *, const void *);
+        \\typedef enum MTLPixelFormat : NSUInteger MTLPixelFormat;
+        \\enum MTLPixelFormat : NSUInteger { MTLPixelFormatInvalid = 0 };
+        \\enum Plain { PlainA };
+        \\union Both { int i; float f; };
+        \\@class NSString, NSArray;
+        \\
+    ;
+    const tokens = try stripAttributes(arena, try tokenize(arena, source, &.{}));
+    var parser: Parser = .{ .arena = arena, .texts = tokens.items(.text), .selected = tokens.items(.selected) };
+    try parser.parse();
+    var e = try Emitter.init(arena, &parser);
+    var array: Container = .{ .name = "NSArray" };
+    try array.generics.put(arena, "ObjectType", {});
+
+    const Case = struct { []const u8, ?*const Container, ?Resolved.Kind, []const u8 };
+    const cases = [_]Case{
+        .{ "id", null, .object, "?objc.id" },
+        .{ "id < MTLDevice >", null, .object, "?objc.id" },
+        .{ "NSString * _Nonnull", null, .object, "?objc.id" },
+        .{ "NSArray < NSString * > *", null, .object, "?objc.id" },
+        .{ "NSString * __autoreleasing *", null, .pointer, "?*?objc.id" },
+        .{ "ObjectType", &array, .object, "?objc.id" },
+        .{ "ObjectType", null, null, "" },
+        .{ "Class", null, .class, "?objc.Class" },
+        .{ "SEL", null, .selector, "?objc.SEL" },
+        .{ "BOOL", null, .boolean, "objc.BOOL" },
+        .{ "BOOL *", null, .pointer, "[*c]objc.BOOL" },
+        .{ "void", null, .void, "void" },
+        .{ "void (^)(id)", null, .pointer, "?*const anyopaque" },
+        .{ "MTLCommandBufferHandler", null, .pointer, "?*const anyopaque" },
+        .{ "CFComparatorFunction", null, .pointer, "?*const anyopaque" },
+        .{ "NSUInteger", null, .scalar, "NSUInteger" },
+        .{ "MTLPixelFormat", null, .scalar, "MTLPixelFormat" },
+        .{ "enum MTLPixelFormat", null, .scalar, "NSUInteger" },
+        .{ "enum Plain", null, .scalar, "c_int" },
+        .{ "unsigned long long", null, .scalar, "c_ulonglong" },
+        .{ "CGPoint", null, .@"struct", "CGPoint" },
+        .{ "const CGPoint *", null, .pointer, "[*c]const CGPoint" },
+        .{ "const void *", null, .pointer, "?*const anyopaque" },
+        .{ "struct Packed", null, null, "" },
+        .{ "union Both", null, null, "" },
+        .{ "union Both *", null, .pointer, "?*anyopaque" },
+        .{ "int [4]", null, null, "" },
+    };
+    for (cases) |case| {
+        const r = try e.resolve(try testTokens(arena, case[0]), case[1]);
+        const kind = if (r) |resolved| resolved.kind else null;
+        const zig = if (r) |resolved| resolved.field() else "";
+        std.testing.expectEqual(case[2], kind) catch |err| {
+            std.debug.print("resolve({s})\n", .{case[0]});
+            return err;
+        };
+        std.testing.expectEqualStrings(case[3], zig) catch |err| {
+            std.debug.print("resolve({s})\n", .{case[0]});
+            return err;
+        };
+    }
+
+    // BOOL is `bool` in a wrapper's signature and `objc.BOOL` in memory.
+    try std.testing.expectEqualStrings("bool", (try e.resolve(&.{"BOOL"}, null)).?.param());
+    // A fixed-type enum is its own type, an integer of the fixed one.
+    try std.testing.expectEqualStrings("c_ulong", (try e.resolve(&.{"MTLPixelFormat"}, null)).?.builtin);
+    try std.testing.expectEqualStrings("pub const MTLPixelFormat = NSUInteger;", e.decls.get("MTLPixelFormat").?);
+    try std.testing.expectEqualStrings(
+        "pub const CGPoint = extern struct {\n    x: f64,\n    y: f64,\n};",
+        e.decls.get("CGPoint").?,
+    );
+}
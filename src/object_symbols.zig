@@ -0,0 +1,103 @@
+//! Reads the external symbols of Mach-O objects and static archives, using
+//! the layouts of <mach-o/loader.h> and <mach-o/nlist.h>. Only 64-bit
+//! little-endian objects (arm64 and x86_64) are read.
+const std = @import("std");
+
+pub const Symbols = struct {
+    /// Left undefined by some object.
+    referenced: std.StringArrayHashMapUnmanaged(void) = .{},
+    defined: std.StringHashMapUnmanaged(void) = .{},
+};
+
+/// Adds the external symbols of a Mach-O object or a static archive of
+/// them.
+pub fn read(arena: std.mem.Allocator, symbols: *Symbols, data: []const u8) !void {
+    if (std.mem.startsWith(u8, data, archive_magic)) {
+        var pos: usize = archive_magic.len;
+        while (pos + archive_header_len <= data.len) {
+            const header = data[pos..][0..archive_header_len];
+            const size = std.fmt.parseInt(usize, std.mem.trimRight(u8, header[48..58], " "), 10) catch
+                return error.InvalidArchive;
+            var member_start = pos + archive_header_len;
+            const member_end = member_start + size;
+            if (member_end > data.len) return error.InvalidArchive;
+            // BSD archives put long names ahead of the data.
+            if (std.mem.startsWith(u8, header[0..16], "#1/")) {
+                const name_len = std.fmt.parseInt(usize, std.mem.trimRight(u8, header[3..16], " "), 10) catch
+                    return error.InvalidArchive;
+                member_start += name_len;
+                if (member_start > member_end) return error.InvalidArchive;
+            }
+            const member = data[member_start..member_end];
+            // Skips the symbol tables and anything else that is not an
+            // object.
+            if (member.len >= 4 and readU32(member, 0) == MH_MAGIC_64) try readObject(arena, symbols, member);
+            pos = member_end + (member_end & 1);
+        }
+        return;
+    }
+    if (data.len >= 4 and readU32(data, 0) == MH_MAGIC_64) return readObject(arena, symbols, data);
+    return error.NotAnObject;
+}
+
+const archive_magic = "!<arch>\n";
+const archive_header_len = 60;
+
+// <mach-o/loader.h> and <mach-o/nlist.h>
+const MH_MAGIC_64 = 0xfeedfacf;
+const mach_header_64_len = 32;
+const LC_SYMTAB = 0x2;
+const nlist_64_len = 16;
+const N_STAB = 0xe0;
+const N_TYPE = 0x0e;
+const N_EXT = 0x01;
+const N_UNDF = 0x0;
+
+/// Collects the external symbols of a 64-bit little-endian object. An
+/// undefined symbol with a value is a tentative definition (a common
+/// symbol), so it is defined. An `_objc_msgSend$<selector>` reference is
+/// a stub the linker synthesizes, which calls `_objc_msgSend`.
+fn readObject(arena: std.mem.Allocator, symbols: *Symbols, data: []const u8) !void {
+    if (data.len < mach_header_64_len) return error.InvalidObject;
+    const ncmds = readU32(data, 16);
+    var pos: usize = mach_header_64_len;
+    var i: u32 = 0;
+    while (i < ncmds) : (i += 1) {
+        if (pos + 8 > data.len) return error.InvalidObject;
+        const cmd = readU32(data, pos);
+        const cmdsize = readU32(data, pos + 4);
+        if (cmdsize < 8 or pos + cmdsize > data.len) return error.InvalidObject;
+        if (cmd == LC_SYMTAB) {
+            if (cmdsize < 24) return error.InvalidObject;
+            const symoff = readU32(data, pos + 8);
+            const nsyms = readU32(data, pos + 12);
+            const stroff = readU32(data, pos + 16);
+            const strsize = readU32(data, pos + 20);
+            if (@as(u64, symoff) + @as(u64, nsyms) * nlist_64_len > data.len or
+                @as(u64, stroff) + strsize > data.len) return error.InvalidObject;
+            const strings = data[stroff..][0..strsize];
+
+            var n: u32 = 0;
+            while (n < nsyms) : (n += 1) {
+                const entry = data[@as(usize, symoff) + @as(usize, n) * nlist_64_len ..][0..nlist_64_len];
+                const n_strx = readU32(entry, 0);
+                const n_type = entry[4];
+                const n_value = std.mem.readInt(u64, entry[8..16], .little);
+                if (n_type & N_STAB != 0 or n_type & N_EXT == 0) continue;
+                if (n_strx >= strings.len) return error.InvalidObject;
+                const name = std.mem.sliceTo(strings[n_strx..], 0);
+                if (n_type & N_TYPE == N_UNDF and n_value == 0) {
+                    const stub = std.mem.startsWith(u8, name, "_objc_msgSend$");
+                    try symbols.referenced.put(arena, if (stub) "_objc_msgSend" else name, {});
+                } else {
+                    try symbols.defined.put(arena, name, {});
+                }
+            }
+        }
+        pos += cmdsize;
+    }
+}
+
+fn readU32(bytes: []const u8, offset: usize) u32 {
+    return std.mem.readInt(u32, bytes[offset..][0..4], .little);
+}
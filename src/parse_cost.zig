@@ -0,0 +1,240 @@
+//! Attributes the parse time of framework umbrellas to the headers they
+//! include, from a `-ftime-trace` (with `-ftime-trace-granularity=0`) and
+//! the `-H` output of one parse of each umbrella.
+//!
+//! Usage: parse_cost <out.json> <out.folded> <frameworks-dir> <include-dir> [<umbrella> <trace.json> <stderr.txt>]...
+//!
+//! The JSON report ranks every header by its inclusive cost (the time
+//! between entering and leaving it) summed over all umbrellas, and gives
+//! its exclusive cost (without the headers it includes), the number of
+//! umbrellas that include it and the shortest include chain that does.
+//! The folded file has one `umbrella;header;...;header <µs>` line per
+//! include stack, for flamegraph.pl, inferno or speedscope.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 5 or (args.len - 5) % 3 != 0) {
+        std.log.err("usage: {s} <out.json> <out.folded> <frameworks-dir> <include-dir> [<umbrella> <trace.json> <stderr.txt>]...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var report: Report = .{
+        .arena = arena,
+        .roots = .{
+            try std.fs.cwd().realpathAlloc(arena, args[3]),
+            try std.fs.cwd().realpathAlloc(arena, args[4]),
+            args[3],
+            args[4],
+        },
+    };
+    var i: usize = 5;
+    while (i < args.len) : (i += 3) {
+        const umbrella = args[i];
+        try report.umbrellas.append(arena, .{ .name = umbrella, .us = 0 });
+        const includes = try std.fs.cwd().readFileAlloc(arena, args[i + 2], std.math.maxInt(u32));
+        try report.addIncludes(umbrella, includes);
+        const trace = try std.fs.cwd().readFileAlloc(arena, args[i + 1], std.math.maxInt(u32));
+        try report.addTrace(umbrella, trace);
+    }
+
+    try report.writeJson(args[1]);
+    try report.writeFolded(args[2]);
+}
+
+const Header = struct {
+    inclusive_us: f64 = 0,
+    exclusive_us: f64 = 0,
+    umbrellas: u32 = 0,
+    /// The umbrella that was counted last, so that each counts once.
+    last_umbrella: []const u8 = "",
+    /// From the umbrella down to the header that includes this one.
+    chain: []const []const u8 = &.{},
+};
+
+const Report = struct {
+    arena: std.mem.Allocator,
+    /// The frameworks and include dirs, resolved and as given.
+    roots: [4][]const u8,
+    umbrellas: std.ArrayListUnmanaged(struct { name: []const u8, us: f64 }) = .{},
+    headers: std.StringArrayHashMapUnmanaged(Header) = .{},
+    /// Exclusive time per include stack.
+    stacks: std.StringArrayHashMapUnmanaged(f64) = .{},
+
+    /// Reads `-H` output, which lists every header entered with one dot
+    /// per level of nesting:
+    ///
+    ///     . /sdk/Frameworks/Foundation.framework/Headers/Foundation.h
+    ///     .. /sdk/Frameworks/CoreFoundation.framework/Headers/CoreFoundation.h
+    fn addIncludes(self: *Report, umbrella: []const u8, text: []const u8) !void {
+        var stack = std.ArrayList([]const u8).init(self.arena);
+        try stack.append(umbrella);
+        var lines = std.mem.splitScalar(u8, text, '\n');
+        while (lines.next()) |line| {
+            // Followed by a list of headers without include guards.
+            if (std.mem.startsWith(u8, line, "Multiple include guards")) break;
+            const depth = std.mem.indexOfNone(u8, line, ".") orelse continue;
+            if (depth == 0 or line[depth] != ' ') continue;
+
+            const name = self.display(std.mem.trimRight(u8, line[depth + 1 ..], "\r"));
+            stack.shrinkRetainingCapacity(@min(depth, stack.items.len));
+            const header = try self.headerNamed(name);
+            if (!std.mem.eql(u8, header.last_umbrella, umbrella)) {
+                header.umbrellas += 1;
+                header.last_umbrella = umbrella;
+            }
+            if (header.chain.len == 0 or stack.items.len < header.chain.len) {
+                header.chain = try self.arena.dupe([]const u8, stack.items);
+            }
+            try stack.append(name);
+        }
+    }
+
+    fn addTrace(self: *Report, umbrella: []const u8, text: []const u8) !void {
+        const Event = struct {
+            name: []const u8 = "",
+            ph: []const u8 = "",
+            ts: f64 = 0,
+            dur: f64 = 0,
+            args: struct { detail: []const u8 = "" } = .{},
+        };
+        const trace = try std.json.parseFromSliceLeaky(
+            struct { traceEvents: []const Event = &.{} },
+            self.arena,
+            text,
+            .{ .ignore_unknown_fields = true },
+        );
+
+        const Span = struct {
+            name: []const u8,
+            ts: f64,
+            dur: f64,
+            children: f64 = 0,
+            stack: []const u8 = "",
+
+            fn lessThan(_: void, a: @This(), b: @This()) bool {
+                return a.ts < b.ts or (a.ts == b.ts and a.dur > b.dur);
+            }
+        };
+        var spans = std.ArrayList(Span).init(self.arena);
+        for (trace.traceEvents, 0..) |event, k| {
+            if (!std.mem.eql(u8, event.name, "Source")) continue;
+            const name = self.display(event.args.detail);
+            if (std.mem.eql(u8, event.ph, "X")) {
+                try spans.append(.{ .name = name, .ts = event.ts, .dur = event.dur });
+            } else if (std.mem.eql(u8, event.ph, "b")) {
+                // Newer clangs write each file as an async begin event
+                // directly followed by its end.
+                if (k + 1 == trace.traceEvents.len) continue;
+                const end = trace.traceEvents[k + 1];
+                if (!std.mem.eql(u8, end.ph, "e")) continue;
+                try spans.append(.{ .name = name, .ts = event.ts, .dur = end.ts - event.ts });
+            }
+        }
+        std.mem.sort(Span, spans.items, {}, Span.lessThan);
+
+        // Spans nest, so the enclosing ones are those that have not ended.
+        const total = &self.umbrellas.items[self.umbrellas.items.len - 1].us;
+        var open = std.ArrayList(*Span).init(self.arena);
+        for (spans.items) |*span| {
+            while (open.items.len > 0 and open.getLast().ts + open.getLast().dur <= span.ts) _ = open.pop();
+            if (open.items.len > 0) {
+                open.getLast().children += span.dur;
+            } else {
+                // The umbrella itself.
+                total.* += span.dur;
+            }
+            const parent = if (open.items.len > 0) open.getLast().stack else umbrella;
+            span.stack = try std.fmt.allocPrint(self.arena, "{s};{s}", .{ parent, span.name });
+            try open.append(span);
+        }
+
+        for (spans.items) |span| {
+            const exclusive = @max(span.dur - span.children, 0);
+            const header = try self.headerNamed(span.name);
+            header.inclusive_us += span.dur;
+            header.exclusive_us += exclusive;
+            const stack = try self.stacks.getOrPutValue(self.arena, span.stack, 0);
+            stack.value_ptr.* += exclusive;
+        }
+    }
+
+    fn headerNamed(self: *Report, name: []const u8) !*Header {
+        return (try self.headers.getOrPutValue(self.arena, name, .{})).value_ptr;
+    }
+
+    /// Shortens a path to how it is included: `Foundation/NSObject.h` for
+    /// `<frameworks>/Foundation.framework/Headers/NSObject.h` (also in
+    /// sub-frameworks) and `sys/types.h` for `<include>/sys/types.h`.
+    fn display(self: *Report, path: []const u8) []const u8 {
+        if (std.mem.lastIndexOf(u8, path, ".framework/Headers/")) |at| {
+            const start = if (std.mem.lastIndexOfScalar(u8, path[0..at], '/')) |slash| slash + 1 else 0;
+            return std.fmt.allocPrint(self.arena, "{s}/{s}", .{
+                path[start..at],
+                path[at + ".framework/Headers/".len ..],
+            }) catch @panic("OOM");
+        }
+        for (self.roots) |root| {
+            if (std.mem.startsWith(u8, path, root) and path.len > root.len and path[root.len] == '/') {
+                return path[root.len + 1 ..];
+            }
+        }
+        return path;
+    }
+
+    fn writeJson(self: *Report, path: []const u8) !void {
+        const Entry = struct {
+            header: []const u8,
+            inclusive_ms: f64,
+            exclusive_ms: f64,
+            umbrellas: u32,
+            chain: []const []const u8,
+        };
+        var entries = std.ArrayList(Entry).init(self.arena);
+        for (self.headers.keys(), self.headers.values()) |name, header| {
+            try entries.append(.{
+                .header = name,
+                .inclusive_ms = header.inclusive_us / std.time.us_per_ms,
+                .exclusive_ms = header.exclusive_us / std.time.us_per_ms,
+                .umbrellas = header.umbrellas,
+                .chain = header.chain,
+            });
+        }
+        std.mem.sort(Entry, entries.items, {}, struct {
+            fn lessThan(_: void, a: Entry, b: Entry) bool {
+                return a.inclusive_ms > b.inclusive_ms;
+            }
+        }.lessThan);
+
+        const Umbrella = struct { name: []const u8, ms: f64 };
+        var umbrellas = std.ArrayList(Umbrella).init(self.arena);
+        for (self.umbrellas.items) |umbrella| {
+            try umbrellas.append(.{ .name = umbrella.name, .ms = umbrella.us / std.time.us_per_ms });
+        }
+
+        const file = try std.fs.cwd().createFile(path, .{});
+        defer file.close();
+        var buf = std.io.bufferedWriter(file.writer());
+        try std.json.stringify(.{
+            .umbrellas = umbrellas.items,
+            .headers = entries.items,
+        }, .{ .whitespace = .indent_2 }, buf.writer());
+        try buf.writer().writeByte('\n');
+        try buf.flush();
+    }
+
+    fn writeFolded(self: *Report, path: []const u8) !void {
+        const file = try std.fs.cwd().createFile(path, .{});
+        defer file.close();
+        var buf = std.io.bufferedWriter(file.writer());
+        for (self.stacks.keys(), self.stacks.values()) |stack, us| {
+            const rounded: u64 = @intFromFloat(@round(us));
+            if (rounded > 0) try buf.writer().print("{s} {d}\n", .{ stack, rounded });
+        }
+        try buf.flush();
+    }
+};
@@ -0,0 +1,63 @@
+//! Times `tbd.parse` over every stub under the given directories, v4 or
+//! v5. The files are read before timing starts.
+//!
+//! Usage: parse_stubs <runs> <dir>...
+//!
+//! Prints the number of stubs, their total size, the symbols parsed per
+//! pass and the mean time of a pass in milliseconds.
+const std = @import("std");
+const tbd = @import("tbd");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3) {
+        std.log.err("usage: {s} <runs> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+    const runs = std.fmt.parseInt(u32, args[1], 10) catch {
+        std.log.err("invalid run count: {s}", .{args[1]});
+        std.process.exit(1);
+    };
+
+    var texts = std.ArrayList([]const u8).init(arena);
+    var bytes: usize = 0;
+    for (args[2..]) |arg| {
+        var dir = try std.fs.cwd().openDir(arg, .{ .iterate = true });
+        defer dir.close();
+        var walker = try dir.walk(arena);
+        defer walker.deinit();
+        while (try walker.next()) |entry| {
+            if (entry.kind != .file or !std.mem.endsWith(u8, entry.basename, ".tbd")) continue;
+            const text = try dir.readFileAlloc(arena, entry.path, std.math.maxInt(u32));
+            bytes += text.len;
+            try texts.append(text);
+        }
+    }
+
+    var pass_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer pass_state.deinit();
+    var symbols: usize = 0;
+    var timer = try std.time.Timer.start();
+    for (0..runs) |_| {
+        _ = pass_state.reset(.retain_capacity);
+        symbols = 0;
+        for (texts.items) |text| {
+            for (try tbd.parse(pass_state.allocator(), text)) |document| {
+                for (document.exports) |list| symbols += list.symbols.len + list.objc_classes.len;
+            }
+        }
+    }
+    const ns = timer.read();
+
+    const stdout = std.io.getStdOut().writer();
+    try stdout.print("{d} stubs, {d} bytes, {d} symbols, {d:.1} ms/pass\n", .{
+        texts.items.len,
+        bytes,
+        symbols,
+        @as(f64, @floatFromInt(ns)) / @as(f64, @floatFromInt(@max(runs, 1))) / std.time.ns_per_ms,
+    });
+}
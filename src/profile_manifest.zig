@@ -0,0 +1,76 @@
+//! Turns the dependency files written by `clang -M` into an SDK profile:
+//! the sorted list of SDK files they name, relative to the SDK root.
+//!
+//! Usage: profile_manifest <out.txt> <sdk-dir> <deps.d>...
+//!
+//! Paths are resolved, so a header reached through a framework's `Headers`
+//! symlink is listed under `Versions/`. Files outside the SDK (the scanned
+//! source, clang's own headers) are left out.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 4) {
+        std.log.err("usage: {s} <out.txt> <sdk-dir> <deps.d>...", .{args[0]});
+        std.process.exit(1);
+    }
+    const sdk = try std.fs.cwd().realpathAlloc(arena, args[2]);
+
+    var files: std.StringArrayHashMapUnmanaged(void) = .{};
+    for (args[3..]) |deps_path| {
+        const text = try std.fs.cwd().readFileAlloc(arena, deps_path, std.math.maxInt(u32));
+        for (try parseDeps(arena, text)) |dep| {
+            const path = std.fs.cwd().realpathAlloc(arena, dep) catch |err| switch (err) {
+                error.FileNotFound => continue,
+                else => return err,
+            };
+            if (!std.mem.startsWith(u8, path, sdk) or path.len <= sdk.len or path[sdk.len] != '/') continue;
+            try files.put(arena, path[sdk.len + 1 ..], {});
+        }
+    }
+
+    std.mem.sort([]const u8, files.keys(), {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    for (files.keys()) |path| try buf.writer().print("{s}\n", .{path});
+    try buf.flush();
+}
+
+/// Returns the prerequisites of a make rule as clang writes them:
+/// `out.o: a.h b.h \` with continuation lines, spaces escaped as `\ `
+/// and `$` as `$$`.
+fn parseDeps(arena: std.mem.Allocator, text: []const u8) ![]const []const u8 {
+    var deps = std.ArrayList([]const u8).init(arena);
+    const colon = std.mem.indexOf(u8, text, ": ") orelse return &.{};
+
+    var dep = std.ArrayList(u8).init(arena);
+    var i = colon + 2;
+    while (i < text.len) : (i += 1) {
+        const c = text[i];
+        if (c == '\\' and i + 1 < text.len and (text[i + 1] == ' ' or text[i + 1] == '#')) {
+            try dep.append(text[i + 1]);
+            i += 1;
+        } else if (c == '$' and i + 1 < text.len and text[i + 1] == '$') {
+            try dep.append('$');
+            i += 1;
+        } else if (c == ' ' or c == '\t' or c == '\r' or c == '\n' or
+            (c == '\\' and i + 1 < text.len and (text[i + 1] == '\n' or text[i + 1] == '\r')))
+        {
+            if (dep.items.len > 0) try deps.append(try dep.toOwnedSlice());
+        } else {
+            try dep.append(c);
+        }
+    }
+    if (dep.items.len > 0) try deps.append(try dep.toOwnedSlice());
+    return deps.items;
+}
@@ -0,0 +1,84 @@
+//! Copies the layout of the SDK's header directories, keeping only the
+//! headers an SDK profile lists. Including anything else fails with "file
+//! not found" instead of quietly pulling in more of the SDK.
+//!
+//! Usage: profile_view <out-dir> <profile.txt> <dir>...
+//!
+//! Each dir is mirrored to `<out-dir>/<basename>`, with profile entries
+//! relative to `<out-dir>` (e.g. `include/stdio.h`). Symlinks are copied as
+//! they are, and listed files and every `.tbd` stub are linked to the
+//! originals. The dirs may be the SDK's or a copy with the same layout,
+//! such as the comment-stripped headers.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 4) {
+        std.log.err("usage: {s} <out-dir> <profile.txt> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var profile: std.StringHashMapUnmanaged(void) = .{};
+    const text = try std.fs.cwd().readFileAlloc(arena, args[2], std.math.maxInt(u32));
+    var lines = std.mem.tokenizeAny(u8, text, "\r\n");
+    while (lines.next()) |line| {
+        if (line[0] == '#') continue;
+        try profile.put(arena, line, {});
+    }
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+
+    for (args[3..]) |arg| {
+        const path = try std.fs.cwd().realpathAlloc(arena, arg);
+        const name = std.fs.path.basename(path);
+        var src = try std.fs.openDirAbsolute(path, .{ .iterate = true });
+        defer src.close();
+        var dst = try out.makeOpenPath(name, .{});
+        defer dst.close();
+        try mirror(arena, &profile, src, path, name, dst);
+    }
+}
+
+fn mirror(
+    arena: std.mem.Allocator,
+    profile: *const std.StringHashMapUnmanaged(void),
+    src: std.fs.Dir,
+    src_path: []const u8,
+    /// Where `src` is relative to the SDK root, as in the profile.
+    rel_path: []const u8,
+    dst: std.fs.Dir,
+) !void {
+    var it = src.iterate();
+    while (try it.next()) |entry| {
+        const rel = try std.fmt.allocPrint(arena, "{s}/{s}", .{ rel_path, entry.name });
+        switch (entry.kind) {
+            .directory => {
+                var sub_src = try src.openDir(entry.name, .{ .iterate = true });
+                defer sub_src.close();
+                var sub_dst = try dst.makeOpenPath(entry.name, .{});
+                defer sub_dst.close();
+                try mirror(arena, profile, sub_src, try std.fs.path.join(arena, &.{ src_path, entry.name }), rel, sub_dst);
+            },
+            .sym_link => {
+                var buf: [std.fs.max_path_bytes]u8 = undefined;
+                try symLink(dst, try src.readLink(entry.name, &buf), entry.name);
+            },
+            .file => if (profile.contains(rel) or std.mem.endsWith(u8, entry.name, ".tbd")) {
+                try symLink(dst, try std.fs.path.join(arena, &.{ src_path, entry.name }), entry.name);
+            },
+            else => {},
+        }
+    }
+}
+
+fn symLink(dir: std.fs.Dir, target: []const u8, name: []const u8) !void {
+    dir.symLink(target, name, .{}) catch |err| switch (err) {
+        error.PathAlreadyExists => {},
+        else => return err,
+    };
+}
@@ -0,0 +1,46 @@
+//! Lists the symbols that Mach-O objects reference but do not define,
+//! which are the symbols they need from libraries. `minimal_tbd` keeps
+//! only these in the stubs it writes.
+//!
+//! Usage: referenced_symbols <out.txt> <object-or-archive>...
+//!
+//! Writes one symbol per line, sorted.
+const std = @import("std");
+const object_symbols = @import("object_symbols");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3) {
+        std.log.err("usage: {s} <out.txt> <object-or-archive>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var symbols: object_symbols.Symbols = .{};
+    for (args[2..]) |path| {
+        const data = try std.fs.cwd().readFileAlloc(arena, path, std.math.maxInt(u32));
+        object_symbols.read(arena, &symbols, data) catch |err| {
+            std.log.err("{s}: {s}", .{ path, @errorName(err) });
+            std.process.exit(1);
+        };
+    }
+
+    var needed = std.ArrayList([]const u8).init(arena);
+    for (symbols.referenced.keys()) |symbol| {
+        if (!symbols.defined.contains(symbol)) try needed.append(symbol);
+    }
+    std.mem.sort([]const u8, needed.items, {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    for (needed.items) |symbol| try buf.writer().print("{s}\n", .{symbol});
+    try buf.flush();
+}
@@ -0,0 +1,46 @@
+//! Checks that two preprocessed files hold the same tokens, whatever the
+//! whitespace between them. Used to verify the comment-stripped headers.
+//!
+//! Usage: same_tokens <a.i> <b.i> [<a-dir> <b-dir>]...
+//!
+//! Each `<b-dir>` in the second file is read as the matching `<a-dir>`,
+//! so that `__FILE__` and the like compare equal.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3 or args.len % 2 != 1) {
+        std.log.err("usage: {s} <a.i> <b.i> [<a-dir> <b-dir>]...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    const a = try std.fs.cwd().readFileAlloc(arena, args[1], std.math.maxInt(u32));
+    var b = try std.fs.cwd().readFileAlloc(arena, args[2], std.math.maxInt(u32));
+    var i: usize = 3;
+    while (i < args.len) : (i += 2) {
+        b = try std.mem.replaceOwned(u8, arena, b, args[i + 1], args[i]);
+    }
+
+    var a_tokens = std.mem.tokenizeAny(u8, a, " \t\r\n");
+    var b_tokens = std.mem.tokenizeAny(u8, b, " \t\r\n");
+    var count: usize = 0;
+    while (true) : (count += 1) {
+        const a_token = a_tokens.next();
+        const b_token = b_tokens.next();
+        if (a_token == null and b_token == null) break;
+        if (a_token != null and b_token != null and std.mem.eql(u8, a_token.?, b_token.?)) continue;
+
+        std.log.err("{s} and {s} differ at token {d}: '{s}' vs '{s}'", .{
+            args[1],
+            args[2],
+            count,
+            a_token orelse "<end>",
+            b_token orelse "<end>",
+        });
+        std.process.exit(1);
+    }
+}
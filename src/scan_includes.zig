@@ -0,0 +1,119 @@
+//! Writes a source that includes every system header a consumer's code
+//! names: each `#include <...>` and `#import <...>` in C, Objective-C and
+//! C++ files and each `@cInclude("...")` in Zig files. Directories are
+//! searched recursively.
+//!
+//! Usage: scan_includes <out.m> <file-or-dir>...
+//!
+//! Every include is wrapped in `__has_include`, so headers of the consumer
+//! or of other platforms are skipped rather than errors. Conditions around
+//! the includes are not evaluated; a header that is only included on some
+//! configurations is always listed.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3) {
+        std.log.err("usage: {s} <out.m> <file-or-dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var headers: std.StringArrayHashMapUnmanaged(void) = .{};
+    for (args[2..]) |path| {
+        const stat = try std.fs.cwd().statFile(path);
+        if (stat.kind != .directory) {
+            try scanFile(arena, &headers, std.fs.cwd(), path);
+            continue;
+        }
+        var dir = try std.fs.cwd().openDir(path, .{ .iterate = true });
+        defer dir.close();
+        var walker = try dir.walk(arena);
+        defer walker.deinit();
+        while (try walker.next()) |entry| {
+            if (entry.kind != .file) continue;
+            // Build outputs and vendored dependencies are not the
+            // consumer's includes.
+            if (std.mem.startsWith(u8, entry.path, ".zig-cache") or
+                std.mem.startsWith(u8, entry.path, "zig-out")) continue;
+            try scanFile(arena, &headers, dir, entry.path);
+        }
+    }
+
+    std.mem.sort([]const u8, headers.keys(), {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    for (headers.keys()) |header| {
+        try buf.writer().print("#if __has_include(<{0s}>)\n#import <{0s}>\n#endif\n", .{header});
+    }
+    try buf.flush();
+}
+
+const source_exts = [_][]const u8{ ".c", ".h", ".m", ".mm", ".cc", ".cpp", ".cxx", ".hh", ".hpp" };
+
+fn scanFile(
+    arena: std.mem.Allocator,
+    headers: *std.StringArrayHashMapUnmanaged(void),
+    dir: std.fs.Dir,
+    path: []const u8,
+) !void {
+    const ext = std.fs.path.extension(path);
+    const zig = std.mem.eql(u8, ext, ".zig");
+    for (source_exts) |source_ext| {
+        if (std.mem.eql(u8, ext, source_ext)) break;
+    } else if (!zig) return;
+
+    const text = try dir.readFileAlloc(arena, path, std.math.maxInt(u32));
+    var lines = std.mem.splitScalar(u8, text, '\n');
+    while (lines.next()) |line| {
+        const header = if (zig) cInclude(line) else directive(line);
+        if (header) |name| try headers.put(arena, name, {});
+    }
+}
+
+/// The header of `#include <...>` or `#import <...>`, allowing spaces
+/// around the `#`.
+fn directive(line: []const u8) ?[]const u8 {
+    var rest = std.mem.trimLeft(u8, line, " \t");
+    if (!std.mem.startsWith(u8, rest, "#")) return null;
+    rest = std.mem.trimLeft(u8, rest[1..], " \t");
+    for ([_][]const u8{ "include", "import" }) |keyword| {
+        if (std.mem.startsWith(u8, rest, keyword)) {
+            rest = std.mem.trimLeft(u8, rest[keyword.len..], " \t");
+            break;
+        }
+    } else return null;
+    if (!std.mem.startsWith(u8, rest, "<")) return null;
+    const end = std.mem.indexOfScalar(u8, rest, '>') orelse return null;
+    return rest[1..end];
+}
+
+/// The header of a `@cInclude("...")`.
+fn cInclude(line: []const u8) ?[]const u8 {
+    const at = std.mem.indexOf(u8, line, "@cInclude(\"") orelse return null;
+    const start = at + "@cInclude(\"".len;
+    const end = std.mem.indexOfScalarPos(u8, line, start, '"') orelse return null;
+    return line[start..end];
+}
+
+test "directive reads angle-bracket includes and imports" {
+    try std.testing.expectEqualStrings("Foundation/Foundation.h", directive("#import <Foundation/Foundation.h>").?);
+    try std.testing.expectEqualStrings("stdio.h", directive("  #  include <stdio.h> // c").?);
+    try std.testing.expect(directive("#include \"local.h\"") == null);
+    try std.testing.expect(directive("#define X <stdio.h>") == null);
+}
+
+test "cInclude reads the header of @cInclude" {
+    try std.testing.expectEqualStrings("Metal/Metal.h", cInclude("    @cInclude(\"Metal/Metal.h\");").?);
+    try std.testing.expect(cInclude("    @cDefine(\"X\", \"1\");") == null);
+    try std.testing.expect(cInclude("@cInclude(\"unterminated") == null);
+}
@@ -0,0 +1,31 @@
+//! Creates a framework search root that holds only the given frameworks,
+//! each as a symlink into the SDK, so that clang cannot find (or waste
+//! lookups on) any other framework.
+//!
+//! Usage: search_root <out-dir> <frameworks-dir> <name>...
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3) {
+        std.log.err("usage: {s} <out-dir> <frameworks-dir> <name>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    const frameworks = try std.fs.cwd().realpathAlloc(arena, args[2]);
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+
+    for (args[3..]) |name| {
+        const link = try std.fmt.allocPrint(arena, "{s}.framework", .{name});
+        const target = try std.fs.path.join(arena, &.{ frameworks, link });
+        out.symLink(target, link, .{ .is_directory = true }) catch |err| switch (err) {
+            error.PathAlreadyExists => {},
+            else => return err,
+        };
+    }
+}
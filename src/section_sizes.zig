@@ -0,0 +1,69 @@
+//! Prints the sizes of sections of a Mach-O image on one line, in the
+//! order given and 0 for a section the image does not have.
+//!
+//! Usage: section_sizes <image> <sectname>...
+//!
+//! Reads 64-bit little-endian images (arm64 and x86_64) with the layouts of
+//! <mach-o/loader.h>. Sections are matched by name alone, in any segment.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3) {
+        std.log.err("usage: {s} <image> <sectname>...", .{args[0]});
+        std.process.exit(1);
+    }
+    const data = try std.fs.cwd().readFileAlloc(arena, args[1], std.math.maxInt(u32));
+    const sizes = sectionSizes(arena, data) catch |err| {
+        std.log.err("{s}: {s}", .{ args[1], @errorName(err) });
+        std.process.exit(1);
+    };
+
+    var out = std.io.bufferedWriter(std.io.getStdOut().writer());
+    for (args[2..], 0..) |name, i| {
+        try out.writer().print("{s}{d}", .{ if (i == 0) "" else " ", sizes.get(name) orelse 0 });
+    }
+    try out.writer().writeByte('\n');
+    try out.flush();
+}
+
+// <mach-o/loader.h>
+const MH_MAGIC_64 = 0xfeedfacf;
+const mach_header_64_len = 32;
+const LC_SEGMENT_64 = 0x19;
+const segment_command_64_len = 72;
+const section_64_len = 80;
+
+/// The total size of each section name in the image.
+fn sectionSizes(arena: std.mem.Allocator, data: []const u8) !std.StringHashMapUnmanaged(u64) {
+    if (data.len < mach_header_64_len or readU32(data, 0) != MH_MAGIC_64) return error.NotAnImage;
+    var sizes: std.StringHashMapUnmanaged(u64) = .{};
+    const ncmds = readU32(data, 16);
+    var pos: usize = mach_header_64_len;
+    for (0..ncmds) |_| {
+        if (pos + 8 > data.len) return error.InvalidImage;
+        const cmd = readU32(data, pos);
+        const cmdsize = readU32(data, pos + 4);
+        if (cmdsize < 8 or pos + cmdsize > data.len) return error.InvalidImage;
+        if (cmd == LC_SEGMENT_64) {
+            const nsects = readU32(data, pos + 64);
+            if (segment_command_64_len + @as(u64, nsects) * section_64_len > cmdsize) return error.InvalidImage;
+            for (0..nsects) |i| {
+                const header = data[pos + segment_command_64_len + i * section_64_len ..][0..section_64_len];
+                const size = std.mem.readInt(u64, header[40..48], .little);
+                const entry = try sizes.getOrPutValue(arena, std.mem.sliceTo(header[0..16], 0), 0);
+                entry.value_ptr.* += size;
+            }
+        }
+        pos += cmdsize;
+    }
+    return sizes;
+}
+
+fn readU32(bytes: []const u8, offset: usize) u32 {
+    return std.mem.readInt(u32, bytes[offset..][0..4], .little);
+}
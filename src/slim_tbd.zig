@@ -0,0 +1,294 @@
+//! Copies directories of `.tbd` stubs with every target but one removed,
+//! e.g. keeping only arm64-macos. The SDK's stubs list up to eight targets
+//! (x86_64, x86_64h, arm64 and arm64e, each for macOS and Mac Catalyst)
+//! and the linker parses the symbols of all of them.
+//!
+//! Usage: slim_tbd <out-dir> <out.d> <target> <headers-dir> <dir>...
+//!
+//! Each dir is mirrored to `<out-dir>/<basename>`. Symlinks are copied as
+//! they are and header and module directories link to their counterparts
+//! under `<headers-dir>/<basename>`, which is the dir's parent or a copy
+//! of it such as the comment-stripped headers. So a mirrored `Frameworks/`
+//! still works as a framework search path. The stubs read are listed in
+//! `<out.d>`.
+const std = @import("std");
+const DepFile = @import("dep_file").DepFile;
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 6) {
+        std.log.err("usage: {s} <out-dir> <out.d> <target> <headers-dir> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+
+    var deps = DepFile.init(arena);
+    const headers = try std.fs.cwd().realpathAlloc(arena, args[4]);
+    for (args[5..]) |arg| {
+        const path = try std.fs.cwd().realpathAlloc(arena, arg);
+        const name = std.fs.path.basename(path);
+        var src = try std.fs.openDirAbsolute(path, .{ .iterate = true });
+        defer src.close();
+        var dst = try out.makeOpenPath(name, .{});
+        defer dst.close();
+        try mirror(arena, src, path, try std.fs.path.join(arena, &.{ headers, name }), dst, args[3], &deps);
+    }
+    try deps.write(args[2]);
+}
+
+/// Directories that hold no stubs. They are linked instead of copied.
+const linked_dirs = [_][]const u8{ "Headers", "PrivateHeaders", "Modules", "Resources" };
+
+fn mirror(
+    arena: std.mem.Allocator,
+    src: std.fs.Dir,
+    src_path: []const u8,
+    /// Where `src` is in the headers dir.
+    headers_path: []const u8,
+    dst: std.fs.Dir,
+    target: []const u8,
+    deps: *DepFile,
+) !void {
+    var it = src.iterate();
+    while (try it.next()) |entry| switch (entry.kind) {
+        .directory => {
+            const path = try std.fs.path.join(arena, &.{ headers_path, entry.name });
+            for (linked_dirs) |name| {
+                if (std.mem.eql(u8, entry.name, name)) {
+                    try symLink(dst, path, entry.name);
+                    break;
+                }
+            } else {
+                var sub_src = try src.openDir(entry.name, .{ .iterate = true });
+                defer sub_src.close();
+                var sub_dst = try dst.makeOpenPath(entry.name, .{});
+                defer sub_dst.close();
+                const sub_src_path = try std.fs.path.join(arena, &.{ src_path, entry.name });
+                try mirror(arena, sub_src, sub_src_path, path, sub_dst, target, deps);
+            }
+        },
+        // Relative links such as `Versions/Current -> A` stay valid in
+        // the copy.
+        .sym_link => {
+            var buf: [std.fs.max_path_bytes]u8 = undefined;
+            try symLink(dst, try src.readLink(entry.name, &buf), entry.name);
+        },
+        .file => {
+            if (!std.mem.endsWith(u8, entry.name, ".tbd")) continue;
+            const text = try src.readFileAlloc(arena, entry.name, std.math.maxInt(u32));
+            try deps.addIn(src_path, entry.name);
+            const slim = try slimStub(arena, text, target);
+            if (slim.len > 0) try dst.writeFile(.{ .sub_path = entry.name, .data = slim });
+        },
+        else => {},
+    };
+}
+
+fn symLink(dir: std.fs.Dir, target: []const u8, name: []const u8) !void {
+    dir.symLink(target, name, .{}) catch |err| switch (err) {
+        error.PathAlreadyExists => {},
+        else => return err,
+    };
+}
+
+/// Returns the documents of a TAPI v4 stub that apply to `target`, with
+/// only the list items (exports, re-exports, uuids...) that apply to it.
+/// Returns an empty string if no document applies.
+///
+/// This is not a YAML parser. It relies on the layout TAPI writes: each
+/// document starts with `---`, keys start at column 0, list items with
+/// `  - ` and everything else is indented continuation.
+fn slimStub(arena: std.mem.Allocator, text: []const u8, target: []const u8) ![]const u8 {
+    var lines = std.ArrayList([]const u8).init(arena);
+    var it = std.mem.splitScalar(u8, text, '\n');
+    while (it.next()) |line| try lines.append(std.mem.trimRight(u8, line, "\r"));
+
+    var out = std.ArrayList(u8).init(arena);
+    var i: usize = 0;
+    while (i < lines.items.len) {
+        if (!std.mem.startsWith(u8, lines.items[i], "---")) {
+            i += 1;
+            continue;
+        }
+        var end = i + 1;
+        while (end < lines.items.len and
+            !std.mem.startsWith(u8, lines.items[end], "---") and
+            !std.mem.startsWith(u8, lines.items[end], "...")) end += 1;
+        try slimDocument(&out, lines.items[i..end], target);
+        i = end;
+    }
+    if (out.items.len == 0) return "";
+    try out.appendSlice("...\n");
+    return joinContinuations(arena, out.items);
+}
+
+/// Puts every flow list on one line. TAPI wraps them at 80 columns and
+/// indents the continuations by 20-odd spaces, a fifth of a stub's bytes.
+fn joinContinuations(arena: std.mem.Allocator, text: []const u8) ![]const u8 {
+    var out = try std.ArrayList(u8).initCapacity(arena, text.len);
+    var it = std.mem.splitScalar(u8, text, '\n');
+    var first = true;
+    while (it.next()) |line| {
+        const trimmed = std.mem.trimLeft(u8, line, " ");
+        const is_continuation = trimmed.len < line.len and !isItem(line) and !isKey(trimmed);
+        if (!first and !is_continuation) try out.append('\n');
+        try out.appendSlice(if (is_continuation) trimmed else line);
+        first = false;
+    }
+    return out.items;
+}
+
+fn isKey(line: []const u8) bool {
+    const end = std.mem.indexOfNone(u8, line, "abcdefghijklmnopqrstuvwxyz-") orelse return false;
+    return end > 0 and line[end] == ':';
+}
+
+fn slimDocument(out: *std.ArrayList(u8), doc: []const []const u8, target: []const u8) !void {
+    const doc_at = out.items.len;
+    try writeLines(out, doc[0..1]);
+
+    var i: usize = 1;
+    while (i < doc.len) {
+        var end = i + 1;
+        while (end < doc.len and doc[end].len > 0 and doc[end][0] == ' ') end += 1;
+        const block = doc[i..end];
+        i = end;
+
+        const colon = std.mem.indexOfScalar(u8, block[0], ':') orelse {
+            try writeLines(out, block);
+            continue;
+        };
+        const key = block[0][0..colon];
+        const value = std.mem.trim(u8, block[0][colon + 1 ..], " ");
+        if (value.len > 0) {
+            if (!std.mem.eql(u8, key, "targets")) {
+                try writeLines(out, block);
+            } else if (hasTarget(block, target)) {
+                try writeTargets(out, block[0], target);
+            } else {
+                // A document for other targets only, e.g. an x86_64h
+                // sub-library.
+                out.shrinkRetainingCapacity(doc_at);
+                return;
+            }
+            continue;
+        }
+
+        // A list of items, each for some of the targets. Drop the key
+        // too if none of them is for ours.
+        const key_at = out.items.len;
+        try writeLines(out, block[0..1]);
+        const items_at = out.items.len;
+        var j: usize = 1;
+        while (j < block.len) {
+            var item_end = j + 1;
+            while (item_end < block.len and !isItem(block[item_end])) item_end += 1;
+            try slimItem(out, block[j..item_end], target);
+            j = item_end;
+        }
+        if (out.items.len == items_at) out.shrinkRetainingCapacity(key_at);
+    }
+}
+
+fn slimItem(out: *std.ArrayList(u8), item: []const []const u8, target: []const u8) !void {
+    for (item, 0..) |line, k| {
+        const field = std.mem.trimLeft(u8, line, " -");
+        if (std.mem.startsWith(u8, field, "target:")) {
+            const value = std.mem.trim(u8, field["target:".len..], " ");
+            if (std.mem.eql(u8, value, target)) try writeLines(out, item);
+            return;
+        }
+        if (std.mem.startsWith(u8, field, "targets:")) {
+            var end = k;
+            while (end < item.len and std.mem.indexOfScalar(u8, item[end], ']') == null) end += 1;
+            end = @min(end + 1, item.len);
+            if (!hasTarget(item[k..end], target)) return;
+
+            try writeLines(out, item[0..k]);
+            try writeTargets(out, line, target);
+            try writeLines(out, item[end..]);
+            return;
+        }
+    }
+    // Items that name no targets apply to all of them.
+    try writeLines(out, item);
+}
+
+/// Whether the flow list spread over `lines` contains `target`.
+fn hasTarget(lines: []const []const u8, target: []const u8) bool {
+    for (lines) |line| {
+        var it = std.mem.tokenizeAny(u8, line, " ,[]");
+        while (it.next()) |token| {
+            if (std.mem.eql(u8, token, target)) return true;
+        }
+    }
+    return false;
+}
+
+/// Rewrites the first line of a `targets:` list, keeping its alignment,
+/// as a list of just `target`.
+fn writeTargets(out: *std.ArrayList(u8), line: []const u8, target: []const u8) !void {
+    const open = std.mem.indexOfScalar(u8, line, '[') orelse line.len;
+    try out.writer().print("{s}[ {s} ]\n", .{ line[0..open], target });
+}
+
+fn isItem(line: []const u8) bool {
+    return std.mem.startsWith(u8, std.mem.trimLeft(u8, line, " "), "- ");
+}
+
+fn writeLines(out: *std.ArrayList(u8), lines: []const []const u8) !void {
+    for (lines) |line| {
+        try out.appendSlice(line);
+        try out.append('\n');
+    }
+}
+
+test "slimStub keeps only the target's documents, targets and items" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const stub =
+        \\--- !tapi-tbd
+        \\tbd-version:     4
+        \\targets:         [ x86_64-macos, arm64-macos,
+        \\                   arm64e-macos ]
+        \\install-name:    '/usr/lib/libfoo.dylib'
+        \\exports:
+        \\  - targets:         [ x86_64-macos, arm64-macos ]
+        \\    symbols:         [ _a, _b ]
+        \\  - targets:         [ x86_64-macos ]
+        \\    symbols:         [ _x ]
+        \\--- !tapi-tbd
+        \\tbd-version:     4
+        \\targets:         [ x86_64h-macos ]
+        \\install-name:    '/usr/lib/libbar.dylib'
+        \\...
+        \\
+    ;
+    try std.testing.expectEqualStrings(
+        \\--- !tapi-tbd
+        \\tbd-version:     4
+        \\targets:         [ arm64-macos ]
+        \\install-name:    '/usr/lib/libfoo.dylib'
+        \\exports:
+        \\  - targets:         [ arm64-macos ]
+        \\    symbols:         [ _a, _b ]
+        \\...
+        \\
+    , try slimStub(arena_state.allocator(), stub, "arm64-macos"));
+    try std.testing.expectEqualStrings("", try slimStub(arena_state.allocator(), stub, "arm64-maccatalyst"));
+}
+
+test "joinContinuations puts flow lists on one line" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    try std.testing.expectEqualStrings(
+        "    symbols:         [ _a, _b,_c ]\n",
+        try joinContinuations(arena_state.allocator(), "    symbols:         [ _a, _b,\n                       _c ]\n"),
+    );
+}
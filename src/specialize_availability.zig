@@ -0,0 +1,649 @@
+//! Writes copies of the availability headers with the conditionals that
+//! are fixed for one target resolved: version comparisons against the
+//! deployment target, `__is_target_os(ios)` and friends, and the
+//! `__has_feature`/`__has_attribute` checks zig's clang always passes.
+//! Every TU includes these headers, and AvailabilityInternalLegacy.h
+//! alone has two thousand conditionals.
+//!
+//! Usage: specialize_availability <out-dir> <out.d> <include-dir> <arch> <min-macos>
+//!
+//! Only the directive lines of resolved conditionals and the text of the
+//! branches that are never taken are removed; each is replaced by an empty
+//! line, so `__LINE__` and diagnostics stay the same. Conditionals that
+//! depend on anything else (user macros, include order, `__has_include`)
+//! are left as they are.
+//!
+//! The copies assume the consumer does not define the deployment target
+//! macros (`MAC_OS_X_VERSION_MIN_REQUIRED`...) itself.
+//!
+//! The headers read are listed in `<out.d>`.
+const std = @import("std");
+const DepFile = @import("dep_file").DepFile;
+
+const headers = [_][]const u8{
+    "Availability.h",
+    "AvailabilityInternal.h",
+    "AvailabilityInternalLegacy.h",
+    "AvailabilityMacros.h",
+    "AvailabilityVersions.h",
+    "os/availability.h",
+};
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 6) {
+        std.log.err("usage: {s} <out-dir> <out.d> <include-dir> <arch> <min-macos>", .{args[0]});
+        std.process.exit(1);
+    }
+    const arch = std.meta.stringToEnum(std.Target.Cpu.Arch, args[4]) orelse {
+        std.log.err("unsupported architecture: {s}", .{args[4]});
+        std.process.exit(1);
+    };
+    const min = std.Target.Query.parseVersion(args[5]) catch {
+        std.log.err("invalid macOS version: {s}", .{args[5]});
+        std.process.exit(1);
+    };
+
+    const include_path = try std.fs.cwd().realpathAlloc(arena, args[3]);
+    var include = try std.fs.openDirAbsolute(include_path, .{});
+    defer include.close();
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+
+    var facts: Facts = .{ .arch = arch };
+    try facts.addConstants(arena, include);
+    try facts.addTarget(arena, versionValue(min));
+
+    var deps = DepFile.init(arena);
+    for (headers) |name| {
+        const text = try include.readFileAlloc(arena, name, std.math.maxInt(u32));
+        try deps.addIn(include_path, name);
+        if (std.fs.path.dirname(name)) |dir| try out.makePath(dir);
+        try out.writeFile(.{ .sub_path = name, .data = try specialize(arena, text, &facts) });
+    }
+    try deps.write(args[2]);
+}
+
+/// The value of `__ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__` for a
+/// version: 101500 for 10.15 and 130000 for 13.0, but 1090 for 10.9.
+fn versionValue(v: std.SemanticVersion) i64 {
+    const major: i64 = @intCast(v.major);
+    const minor: i64 = @intCast(v.minor);
+    const patch: i64 = @intCast(v.patch);
+    if (major >= 11 or minor >= 10) return major * 10000 + minor * 100 + patch;
+    return major * 100 + minor * 10 + @min(patch, 9);
+}
+
+/// What is known about the target and the compiler. Anything else is
+/// unknown, including every macro a consumer could define.
+const Facts = struct {
+    arch: std.Target.Cpu.Arch,
+    /// Macros known to expand to a number wherever the headers test them.
+    values: std.StringHashMapUnmanaged(i64) = .{},
+    /// Macros known to be defined or not.
+    defined: std.StringHashMapUnmanaged(bool) = .{},
+
+    /// The version constants, e.g. `__MAC_13_0` and
+    /// `MAC_OS_X_VERSION_10_9`, some of which are defined as others.
+    fn addConstants(facts: *Facts, arena: std.mem.Allocator, include: std.fs.Dir) !void {
+        var aliases = std.StringArrayHashMap([]const u8).init(arena);
+        for ([_][]const u8{ "AvailabilityVersions.h", "AvailabilityMacros.h" }) |name| {
+            const text = try include.readFileAlloc(arena, name, std.math.maxInt(u32));
+            var lines = std.mem.splitScalar(u8, text, '\n');
+            while (lines.next()) |line| {
+                if (!std.mem.startsWith(u8, std.mem.trimLeft(u8, line, " \t"), "#")) continue;
+                var tokens = std.mem.tokenizeAny(u8, line, " \t\r#");
+                if (!std.mem.eql(u8, tokens.next() orelse continue, "define")) continue;
+                const macro = tokens.next() orelse continue;
+                const value = tokens.next() orelse continue;
+                if (tokens.next() != null or !isVersionConstant(macro)) continue;
+                if (parseNumber(value)) |number| {
+                    try facts.values.put(arena, macro, number);
+                } else try aliases.put(macro, value);
+            }
+        }
+        var changed = true;
+        while (changed) {
+            changed = false;
+            for (aliases.keys(), aliases.values()) |macro, value| {
+                if (facts.values.contains(macro)) continue;
+                const number = facts.values.get(value) orelse continue;
+                try facts.values.put(arena, macro, number);
+                changed = true;
+            }
+        }
+    }
+
+    fn addTarget(facts: *Facts, arena: std.mem.Allocator, min: i64) !void {
+        for ([_][]const u8{
+            "__ENVIRONMENT_OS_VERSION_MIN_REQUIRED__",
+            "__ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__",
+        }) |macro| {
+            try facts.values.put(arena, macro, min);
+            try facts.defined.put(arena, macro, true);
+        }
+        // Defined by the headers as the above, before any comparison.
+        try facts.values.put(arena, "__MAC_OS_X_VERSION_MIN_REQUIRED", min);
+        try facts.values.put(arena, "MAC_OS_X_VERSION_MIN_REQUIRED", min);
+        // Predefined for the other platforms only.
+        for ([_][]const u8{ "IPHONE_OS", "TV_OS", "WATCH_OS", "BRIDGE_OS", "DRIVERKIT", "VISION_OS" }) |platform| {
+            const macro = try std.fmt.allocPrint(arena, "__ENVIRONMENT_{s}_VERSION_MIN_REQUIRED__", .{platform});
+            try facts.values.put(arena, macro, 0);
+            try facts.defined.put(arena, macro, false);
+        }
+        for ([_][]const u8{ "__has_feature", "__has_attribute", "__has_builtin" }) |macro| {
+            try facts.defined.put(arena, macro, true);
+        }
+    }
+
+    /// The result of a function-like check such as `__has_feature(x)`.
+    fn call(facts: *const Facts, name: []const u8, arg: []const u8) ?bool {
+        const eql = std.mem.eql;
+        if (eql(u8, name, "__has_feature")) {
+            for ([_][]const u8{
+                "attribute_availability",
+                "attribute_availability_app_extension",
+                "attribute_availability_swift",
+                "attribute_availability_tvos",
+                "attribute_availability_watchos",
+                "attribute_availability_with_message",
+                "attribute_availability_with_replacement",
+                "attribute_deprecated_with_message",
+            }) |feature| {
+                if (eql(u8, arg, feature)) return true;
+            }
+        } else if (eql(u8, name, "__has_attribute")) {
+            if (eql(u8, arg, "availability") or eql(u8, arg, "deprecated")) return true;
+        } else if (eql(u8, name, "__has_builtin")) {
+            for ([_][]const u8{ "arch", "vendor", "os", "environment", "variant_os", "variant_environment" }) |check| {
+                if (std.mem.startsWith(u8, arg, "__is_target_") and eql(u8, arg["__is_target_".len..], check)) return true;
+            }
+        } else if (eql(u8, name, "__is_target_os")) {
+            if (eql(u8, arg, "macos")) return true;
+            for ([_][]const u8{ "ios", "tvos", "watchos", "driverkit", "visionos", "xros", "bridgeos" }) |os| {
+                if (eql(u8, arg, os)) return false;
+            }
+        } else if (eql(u8, name, "__is_target_vendor")) {
+            if (eql(u8, arg, "apple")) return true;
+        } else if (eql(u8, name, "__is_target_environment")) {
+            if (eql(u8, arg, "macabi") or eql(u8, arg, "simulator")) return false;
+        } else if (eql(u8, name, "__is_target_variant_os") or eql(u8, name, "__is_target_variant_environment")) {
+            // zig never builds zippered (macOS plus Mac Catalyst) code.
+            return false;
+        } else if (eql(u8, name, "__is_target_arch")) {
+            const arm = eql(u8, arg, "arm64") or eql(u8, arg, "aarch64");
+            const x86 = eql(u8, arg, "x86_64");
+            return switch (facts.arch) {
+                .aarch64 => if (arm) true else if (x86 or eql(u8, arg, "arm64e") or eql(u8, arg, "i386")) false else null,
+                .x86_64 => if (x86) true else if (arm or eql(u8, arg, "arm64e") or eql(u8, arg, "i386")) false else null,
+                else => null,
+            };
+        }
+        return null;
+    }
+};
+
+fn isVersionConstant(macro: []const u8) bool {
+    for ([_][]const u8{ "__MAC_", "MAC_OS_X_VERSION_", "MAC_OS_VERSION_" }) |prefix| {
+        if (!std.mem.startsWith(u8, macro, prefix)) continue;
+        const version = macro[prefix.len..];
+        return version.len > 0 and std.ascii.isDigit(version[0]) and
+            std.mem.indexOfNone(u8, version, "0123456789_") == null;
+    }
+    return false;
+}
+
+fn parseNumber(token: []const u8) ?i64 {
+    const digits = std.mem.trimRight(u8, token, "uUlL");
+    return std.fmt.parseInt(i64, digits, 0) catch null;
+}
+
+const Kind = enum { @"if", ifdef, ifndef, elif, @"else", endif };
+
+const Directive = struct {
+    kind: Kind,
+    /// Without comments.
+    condition: []const u8,
+    /// The lines it spans, with continuations.
+    first: usize,
+    last: usize,
+    /// Ends inside a block comment, which later lines continue.
+    open_comment: bool,
+};
+
+const Chain = struct {
+    branches: std.ArrayListUnmanaged(usize) = .{},
+    endif: usize = undefined,
+};
+
+fn specialize(arena: std.mem.Allocator, text: []const u8, facts: *const Facts) ![]const u8 {
+    var lines = std.ArrayList([]const u8).init(arena);
+    var it = std.mem.splitScalar(u8, text, '\n');
+    while (it.next()) |line| try lines.append(line);
+
+    var directives = std.ArrayList(Directive).init(arena);
+    var in_comment = false;
+    var i: usize = 0;
+    while (i < lines.items.len) : (i += 1) {
+        const first = i;
+        const starts_in_comment = in_comment;
+        var code = try stripComments(arena, lines.items[i], &in_comment);
+        if (starts_in_comment or !std.mem.startsWith(u8, std.mem.trimLeft(u8, code, " \t"), "#")) continue;
+
+        // Join the continuation lines of the directive.
+        var full = lines.items[i];
+        while (std.mem.endsWith(u8, std.mem.trimRight(u8, full, " \t\r"), "\\") and i + 1 < lines.items.len) {
+            i += 1;
+            const joined = std.mem.trimRight(u8, full, " \t\r");
+            full = try std.mem.concat(arena, u8, &.{ joined[0 .. joined.len - 1], " ", lines.items[i] });
+        }
+        in_comment = false;
+        code = try stripComments(arena, full, &in_comment);
+
+        var rest = std.mem.trimLeft(u8, std.mem.trimLeft(u8, code, " \t")[1..], " \t");
+        const end = std.mem.indexOfNone(u8, rest, "abcdefghijklmnopqrstuvwxyz") orelse rest.len;
+        const kind = std.meta.stringToEnum(Kind, rest[0..end]) orelse continue;
+        rest = std.mem.trim(u8, rest[end..], " \t\r");
+        try directives.append(.{
+            .kind = kind,
+            .condition = rest,
+            .first = first,
+            .last = i,
+            .open_comment = in_comment,
+        });
+    }
+
+    var chains = std.ArrayList(*Chain).init(arena);
+    var open = std.ArrayList(*Chain).init(arena);
+    for (directives.items, 0..) |directive, d| switch (directive.kind) {
+        .@"if", .ifdef, .ifndef => {
+            const chain = try arena.create(Chain);
+            chain.* = .{};
+            try chain.branches.append(arena, d);
+            try chains.append(chain);
+            try open.append(chain);
+        },
+        .elif, .@"else" => {
+            if (open.items.len == 0) return text;
+            try open.getLast().branches.append(arena, d);
+        },
+        .endif => {
+            if (open.items.len == 0) return text;
+            open.pop().?.endif = d;
+        },
+    };
+    // Unbalanced; leave the file to the compiler.
+    if (open.items.len > 0) return text;
+
+    const blank = try arena.alloc(bool, lines.items.len);
+    @memset(blank, false);
+    const rewrite = try arena.alloc(?[]const u8, lines.items.len);
+    @memset(rewrite, null);
+
+    for (chains.items) |chain| {
+        const branches = chain.branches.items;
+        var comment_spans_directive = directives.items[chain.endif].open_comment;
+        for (branches) |b| comment_spans_directive = comment_spans_directive or directives.items[b].open_comment;
+        if (comment_spans_directive) continue;
+
+        // Each branch is dropped, kept with its condition or, once one is
+        // known to be taken, kept as the last.
+        const Fate = enum { dropped, kept, taken };
+        const fates = try arena.alloc(Fate, branches.len);
+        var taken = false;
+        var resolved = false;
+        for (branches, fates) |b, *fate| {
+            const value: ?bool = if (taken) false else branchValue(facts, directives.items[b]);
+            fate.* = if (value == null) .kept else if (value.?) .taken else .dropped;
+            if (value != null) resolved = true;
+            if (value == true) taken = true;
+        }
+        if (!resolved) continue;
+
+        for (branches, fates, 0..) |b, fate, k| {
+            if (fate != .dropped) continue;
+            blankLines(blank, directives.items[b].first, directives.items[b].last);
+            const body_end = if (k + 1 < branches.len) directives.items[branches[k + 1]].first else directives.items[chain.endif].first;
+            blankLines(blank, directives.items[b].last + 1, body_end -| 1);
+        }
+
+        var kept: usize = 0;
+        for (fates) |fate| kept += @intFromBool(fate != .dropped);
+        const only_taken = kept == 1 and std.mem.indexOfScalar(Fate, fates, .taken) != null;
+        if (kept == 0 or only_taken) {
+            // No conditional is left, only (at most) a body.
+            for (branches, fates) |b, fate| {
+                if (fate == .taken) blankLines(blank, directives.items[b].first, directives.items[b].last);
+            }
+            blankLines(blank, directives.items[chain.endif].first, directives.items[chain.endif].last);
+            continue;
+        }
+
+        var first_kept = true;
+        for (branches, fates) |b, fate| {
+            if (fate == .dropped) continue;
+            const directive = directives.items[b];
+            if (first_kept and directive.kind == .elif) {
+                rewrite[directive.first] = try elifToIf(arena, lines.items[directive.first]);
+            } else if (fate == .taken and directive.kind != .@"else") {
+                blankLines(blank, directive.first, directive.last);
+                blank[directive.first] = false;
+                rewrite[directive.first] = "#else";
+            }
+            first_kept = false;
+        }
+    }
+
+    var out = try std.ArrayList(u8).initCapacity(arena, text.len);
+    for (lines.items, blank, rewrite, 0..) |line, is_blank, replacement, n| {
+        if (n > 0) try out.append('\n');
+        if (!is_blank) try out.appendSlice(replacement orelse line);
+    }
+    return out.items;
+}
+
+fn blankLines(blank: []bool, first: usize, last: usize) void {
+    if (last < first) return;
+    @memset(blank[first .. last + 1], true);
+}
+
+fn branchValue(facts: *const Facts, directive: Directive) ?bool {
+    return switch (directive.kind) {
+        .@"else" => true,
+        .ifdef, .ifndef => {
+            var tokens = std.mem.tokenizeAny(u8, directive.condition, " \t");
+            const defined = facts.defined.get(tokens.next() orelse return null) orelse return null;
+            return if (directive.kind == .ifdef) defined else !defined;
+        },
+        .@"if", .elif => {
+            var parser: Parser = .{ .facts = facts, .text = directive.condition };
+            const value = parser.expression(0) catch return null;
+            parser.skipSpace();
+            if (parser.pos != parser.text.len) return null;
+            return if (value) |v| v != 0 else null;
+        },
+        .endif => unreachable,
+    };
+}
+
+fn elifToIf(arena: std.mem.Allocator, line: []const u8) ![]const u8 {
+    const at = std.mem.indexOf(u8, line, "elif").?;
+    return std.mem.concat(arena, u8, &.{ line[0..at], "if", line[at + "elif".len ..] });
+}
+
+/// Replaces block comments with a space and drops line comments. String
+/// and character literals are kept as they are.
+fn stripComments(arena: std.mem.Allocator, line: []const u8, in_comment: *bool) ![]const u8 {
+    var out = std.ArrayList(u8).init(arena);
+    var i: usize = 0;
+    while (i < line.len) {
+        if (in_comment.*) {
+            const end = std.mem.indexOfPos(u8, line, i, "*/") orelse break;
+            i = end + 2;
+            in_comment.* = false;
+            try out.append(' ');
+        } else if (std.mem.startsWith(u8, line[i..], "/*")) {
+            in_comment.* = true;
+            i += 2;
+        } else if (std.mem.startsWith(u8, line[i..], "//")) {
+            break;
+        } else if (line[i] == '"' or line[i] == '\'') {
+            var j = i + 1;
+            while (j < line.len and line[j] != line[i]) : (j += 1) {
+                if (line[j] == '\\') j += 1;
+            }
+            const end = @min(j + 1, line.len);
+            try out.appendSlice(line[i..end]);
+            i = end;
+        } else {
+            try out.append(line[i]);
+            i += 1;
+        }
+    }
+    return out.items;
+}
+
+/// Evaluates `#if` expressions to a number, or null where the value
+/// depends on something unknown. `&&` and `||` short-circuit on known
+/// operands, so `defined(__has_feature) && __has_feature(x)` resolves
+/// even where `x` does not.
+const Parser = struct {
+    facts: *const Facts,
+    text: []const u8,
+    pos: usize = 0,
+
+    const Error = error{Unsupported};
+
+    fn skipSpace(p: *Parser) void {
+        while (p.pos < p.text.len and std.ascii.isWhitespace(p.text[p.pos])) p.pos += 1;
+    }
+
+    fn peek(p: *Parser) []const u8 {
+        p.skipSpace();
+        const rest = p.text[p.pos..];
+        if (rest.len == 0) return "";
+        if (isIdentifier(rest[0])) {
+            return rest[0 .. std.mem.indexOfNone(u8, rest, identifier_chars) orelse rest.len];
+        }
+        for ([_][]const u8{ "&&", "||", "==", "!=", "<=", ">=", "<<", ">>" }) |op| {
+            if (std.mem.startsWith(u8, rest, op)) return op;
+        }
+        return rest[0..1];
+    }
+
+    fn next(p: *Parser) []const u8 {
+        const token = p.peek();
+        p.pos += token.len;
+        return token;
+    }
+
+    fn expect(p: *Parser, token: []const u8) Error!void {
+        if (!std.mem.eql(u8, p.next(), token)) return error.Unsupported;
+    }
+
+    fn primary(p: *Parser) Error!?i64 {
+        const token = p.next();
+        if (token.len == 0) return error.Unsupported;
+        switch (token[0]) {
+            '(' => {
+                const value = try p.expression(0);
+                try p.expect(")");
+                return value;
+            },
+            '!' => return if (try p.primary()) |v| @intFromBool(v == 0) else null,
+            '-' => return if (try p.primary()) |v| -%v else null,
+            '~' => return if (try p.primary()) |v| ~v else null,
+            else => {},
+        }
+        if (!isIdentifier(token[0])) return error.Unsupported;
+        if (std.ascii.isDigit(token[0])) return parseNumber(token) orelse error.Unsupported;
+
+        if (std.mem.eql(u8, token, "defined")) {
+            const paren = std.mem.eql(u8, p.peek(), "(");
+            if (paren) _ = p.next();
+            const macro = p.next();
+            if (paren) try p.expect(")");
+            const defined = p.facts.defined.get(macro) orelse return null;
+            return @intFromBool(defined);
+        }
+        if (std.mem.eql(u8, p.peek(), "(")) {
+            _ = p.next();
+            const start = p.pos;
+            var depth: usize = 0;
+            while (true) {
+                const arg = p.next();
+                if (arg.len == 0) return error.Unsupported;
+                if (std.mem.eql(u8, arg, "(")) depth += 1;
+                if (std.mem.eql(u8, arg, ")")) {
+                    if (depth == 0) break;
+                    depth -= 1;
+                }
+            }
+            const arg = std.mem.trim(u8, p.text[start .. p.pos - 1], " \t");
+            const result = p.facts.call(token, arg) orelse return null;
+            return @intFromBool(result);
+        }
+        return p.facts.values.get(token);
+    }
+
+    fn expression(p: *Parser, min_precedence: u8) Error!?i64 {
+        var lhs = try p.primary();
+        while (true) {
+            const op = p.peek();
+            const precedence = precedenceOf(op) orelse return lhs;
+            if (precedence < min_precedence) return lhs;
+            _ = p.next();
+            const rhs = try p.expression(precedence + 1);
+            lhs = apply(op, lhs, rhs);
+        }
+    }
+
+    fn precedenceOf(op: []const u8) ?u8 {
+        const table = .{
+            .{ "||", 1 }, .{ "&&", 2 }, .{ "|", 3 },  .{ "^", 4 },  .{ "&", 5 },
+            .{ "==", 6 }, .{ "!=", 6 }, .{ "<", 7 },  .{ ">", 7 },  .{ "<=", 7 },
+            .{ ">=", 7 }, .{ "+", 9 },  .{ "-", 9 },  .{ "*", 10 }, .{ "/", 10 },
+            .{ "%", 10 },
+        };
+        inline for (table) |entry| {
+            if (std.mem.eql(u8, op, entry[0])) return entry[1];
+        }
+        return null;
+    }
+
+    fn apply(op: []const u8, lhs: ?i64, rhs: ?i64) ?i64 {
+        const eql = std.mem.eql;
+        if (eql(u8, op, "&&")) {
+            if (lhs == 0 or rhs == 0) return 0;
+            if (lhs == null or rhs == null) return null;
+            return 1;
+        }
+        if (eql(u8, op, "||")) {
+            if ((lhs != null and lhs != 0) or (rhs != null and rhs != 0)) return 1;
+            if (lhs == null or rhs == null) return null;
+            return 0;
+        }
+        const a = lhs orelse return null;
+        const b = rhs orelse return null;
+        if (eql(u8, op, "|")) return a | b;
+        if (eql(u8, op, "^")) return a ^ b;
+        if (eql(u8, op, "&")) return a & b;
+        if (eql(u8, op, "==")) return @intFromBool(a == b);
+        if (eql(u8, op, "!=")) return @intFromBool(a != b);
+        if (eql(u8, op, "<")) return @intFromBool(a < b);
+        if (eql(u8, op, ">")) return @intFromBool(a > b);
+        if (eql(u8, op, "<=")) return @intFromBool(a <= b);
+        if (eql(u8, op, ">=")) return @intFromBool(a >= b);
+        if (eql(u8, op, "+")) return a +% b;
+        if (eql(u8, op, "-")) return a -% b;
+        if (eql(u8, op, "*")) return a *% b;
+        if (eql(u8, op, "/")) return if (b != 0) @divTrunc(a, b) else null;
+        if (eql(u8, op, "%")) return if (b != 0) @rem(a, b) else null;
+        unreachable;
+    }
+};
+
+const identifier_chars = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+
+fn isIdentifier(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '_';
+}
+
+/// arm64 at macOS 13.0, with the one version constant the tests compare.
+fn testFacts(arena: std.mem.Allocator) !Facts {
+    var facts: Facts = .{ .arch = .aarch64 };
+    try facts.addTarget(arena, 130000);
+    try facts.values.put(arena, "__MAC_12_0", 120000);
+    return facts;
+}
+
+fn expectSpecialized(expected: []const u8, text: []const u8) !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+    const facts = try testFacts(arena);
+    try std.testing.expectEqualStrings(expected, try specialize(arena, text, &facts));
+}
+
+test "specialize makes the first kept #elif an #if" {
+    try expectSpecialized(
+        \\
+        \\
+        \\#if defined(FOO)
+        \\foo
+        \\#else
+        \\new
+        \\#endif
+        \\
+    ,
+        \\#if __MAC_OS_X_VERSION_MIN_REQUIRED < __MAC_12_0
+        \\old
+        \\#elif defined(FOO)
+        \\foo
+        \\#else
+        \\new
+        \\#endif
+        \\
+    );
+}
+
+test "specialize drops the branches after a taken one" {
+    try expectSpecialized("\na\n\n\n\n",
+        \\#if __MAC_OS_X_VERSION_MIN_REQUIRED >= __MAC_12_0
+        \\a
+        \\#elif defined(FOO)
+        \\b
+        \\#endif
+        \\
+    );
+    // __has_feature resolves; the comment after it is not part of the
+    // condition.
+    try expectSpecialized("\na\n\n\n\n",
+        \\#if __has_feature(attribute_availability) /* c */
+        \\a
+        \\#else
+        \\b
+        \\#endif
+        \\
+    );
+}
+
+test "specialize resolves directives continued over several lines" {
+    // Unknown && false is false; every line of the directive is blanked.
+    try expectSpecialized("\n\n\n\ny\n",
+        \\#if defined(FOO) && \
+        \\    __MAC_OS_X_VERSION_MIN_REQUIRED < __MAC_12_0
+        \\x
+        \\#endif
+        \\y
+        \\
+    );
+    // Unknown || false stays unknown, and the file as it was.
+    const unresolved =
+        \\#if defined(FOO) || \
+        \\    __MAC_OS_X_VERSION_MIN_REQUIRED < __MAC_12_0
+        \\x
+        \\#endif
+        \\
+    ;
+    try expectSpecialized(unresolved, unresolved);
+}
+
+test "stripComments keeps literals with escapes" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+    var in_comment = false;
+    try std.testing.expectEqualStrings(
+        "a \"/* \\\" */\"   b",
+        try stripComments(arena, "a \"/* \\\" */\" /* c */ b", &in_comment),
+    );
+    try std.testing.expectEqualStrings("x '\\'' ", try stripComments(arena, "x '\\'' /* y", &in_comment));
+    try std.testing.expect(in_comment);
+    try std.testing.expectEqualStrings("  w", try stripComments(arena, "z */ w", &in_comment));
+    try std.testing.expect(!in_comment);
+}
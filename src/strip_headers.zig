@@ -0,0 +1,256 @@
+//! Copies directories of headers with comments removed and whitespace
+//! collapsed. Apple's headers are mostly documentation (CarbonEvents.h is
+//! 634 KB), which the preprocessor has to lex on every include.
+//!
+//! Usage: strip_headers <out-dir> <out.d> <dir>...
+//!
+//! Each dir is mirrored to `<out-dir>/<basename>`. Symlinks are copied as
+//! they are and files that are not headers (stubs, MIG definitions...)
+//! are linked to the originals. The headers read are listed in `<out.d>`.
+//!
+//! Line breaks are kept, so diagnostics and `__LINE__` point at the same
+//! lines as in the original. The output is only ever generated locally;
+//! it is not a file this package may distribute.
+const std = @import("std");
+const DepFile = @import("dep_file").DepFile;
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 4) {
+        std.log.err("usage: {s} <out-dir> <out.d> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+
+    var deps = DepFile.init(arena);
+    for (args[3..]) |arg| {
+        const path = try std.fs.cwd().realpathAlloc(arena, arg);
+        var src = try std.fs.openDirAbsolute(path, .{ .iterate = true });
+        defer src.close();
+        var dst = try out.makeOpenPath(std.fs.path.basename(path), .{});
+        defer dst.close();
+        try mirror(arena, src, path, dst, &deps);
+    }
+    try deps.write(args[2]);
+}
+
+fn mirror(arena: std.mem.Allocator, src: std.fs.Dir, src_path: []const u8, dst: std.fs.Dir, deps: *DepFile) !void {
+    var it = src.iterate();
+    while (try it.next()) |entry| switch (entry.kind) {
+        .directory => {
+            var sub_src = try src.openDir(entry.name, .{ .iterate = true });
+            defer sub_src.close();
+            var sub_dst = try dst.makeOpenPath(entry.name, .{});
+            defer sub_dst.close();
+            try mirror(arena, sub_src, try std.fs.path.join(arena, &.{ src_path, entry.name }), sub_dst, deps);
+        },
+        .sym_link => {
+            var buf: [std.fs.max_path_bytes]u8 = undefined;
+            try symLink(dst, try src.readLink(entry.name, &buf), entry.name);
+        },
+        .file => if (isHeader(entry.name)) {
+            const text = try src.readFileAlloc(arena, entry.name, std.math.maxInt(u32));
+            try deps.addIn(src_path, entry.name);
+            try dst.writeFile(.{ .sub_path = entry.name, .data = try strip(arena, text) });
+        } else {
+            try symLink(dst, try std.fs.path.join(arena, &.{ src_path, entry.name }), entry.name);
+        },
+        else => {},
+    };
+}
+
+/// libc++'s headers have no extension.
+fn isHeader(name: []const u8) bool {
+    const ext = std.fs.path.extension(name);
+    for ([_][]const u8{ "", ".h", ".hpp", ".inc", ".ipp", ".def" }) |header_ext| {
+        if (std.mem.eql(u8, ext, header_ext)) return true;
+    }
+    return false;
+}
+
+fn symLink(dir: std.fs.Dir, target: []const u8, name: []const u8) !void {
+    dir.symLink(target, name, .{}) catch |err| switch (err) {
+        error.PathAlreadyExists => {},
+        else => return err,
+    };
+}
+
+/// Returns `text` with every comment replaced by a space, runs of
+/// whitespace collapsed to one space and leading and trailing whitespace
+/// removed. Each comment is a single space to the preprocessor, so the
+/// tokens and the spacing between them that it sees are unchanged.
+///
+/// A line break inside a comment is written as a backslash and a line
+/// break, so the comment cannot end a directive early and the tokens
+/// after it stay on their original lines.
+fn strip(arena: std.mem.Allocator, text: []const u8) ![]const u8 {
+    var out = try std.ArrayList(u8).initCapacity(arena, text.len);
+
+    // Whitespace (or a comment) since the last character written.
+    var space = false;
+    var line_start = true;
+    // The line is the continuation of a line ending in a backslash.
+    var continued = false;
+
+    var i: usize = 0;
+    while (i < text.len) {
+        const c = text[i];
+        if (continuation(text, i)) |next| {
+            // The line goes on, and so does any space before the backslash.
+            try out.appendSlice("\\\n");
+            i = next;
+            line_start = true;
+            continued = true;
+            continue;
+        }
+        switch (c) {
+            '\n' => {
+                try out.append('\n');
+                i += 1;
+                space = false;
+                line_start = true;
+                continued = false;
+                continue;
+            },
+            ' ', '\t', '\r', '\x0b', '\x0c' => {
+                space = true;
+                i += 1;
+                continue;
+            },
+            '/' => if (i + 1 < text.len and text[i + 1] == '/') {
+                // Up to the line break, which may be continued.
+                i += 2;
+                while (i < text.len and text[i] != '\n') {
+                    if (continuation(text, i)) |next| {
+                        try out.appendSlice("\\\n");
+                        line_start = true;
+                        continued = true;
+                        i = next;
+                    } else i += 1;
+                }
+                space = true;
+                continue;
+            } else if (i + 1 < text.len and text[i + 1] == '*') {
+                const end = std.mem.indexOfPos(u8, text, i + 2, "*/") orelse {
+                    try out.appendSlice(text[i..]);
+                    break;
+                };
+                for (text[i..end]) |comment_c| {
+                    if (comment_c != '\n') continue;
+                    try out.appendSlice("\\\n");
+                    line_start = true;
+                    continued = true;
+                }
+                i = end + 2;
+                space = true;
+                continue;
+            },
+            else => {},
+        }
+
+        // Leading whitespace only matters on a continued line, where it
+        // separates the token from the end of the previous line.
+        if (space and (!line_start or continued)) try out.append(' ');
+        space = false;
+        line_start = false;
+
+        const end = switch (c) {
+            '"' => if (isRawString(text, i)) rawStringEnd(text, i) else literalEnd(text, i),
+            '\'' => literalEnd(text, i),
+            else => i + 1,
+        };
+        try out.appendSlice(text[i..end]);
+        i = end;
+    }
+    return out.items;
+}
+
+/// If a backslash at `i` is followed by a line break (allowing trailing
+/// whitespace, as clang does), returns the index after the line break.
+fn continuation(text: []const u8, i: usize) ?usize {
+    if (text[i] != '\\') return null;
+    var j = i + 1;
+    while (j < text.len and (text[j] == ' ' or text[j] == '\t' or text[j] == '\r')) j += 1;
+    if (j < text.len and text[j] == '\n') return j + 1;
+    return null;
+}
+
+/// Returns the index after the string or character literal that starts at
+/// `i`. A quote without a closing quote on the same line (an apostrophe in
+/// `#error` or skipped text) is just itself.
+fn literalEnd(text: []const u8, i: usize) usize {
+    const quote = text[i];
+    var j = i + 1;
+    while (j < text.len) : (j += 1) {
+        switch (text[j]) {
+            '\\' => j += 1,
+            '\n' => break,
+            else => if (text[j] == quote) return j + 1,
+        }
+    }
+    return i + 1;
+}
+
+/// Whether the quote at `i` starts a C++ raw string, e.g. `R"(...)"` or
+/// `u8R"x(...)x"`.
+fn isRawString(text: []const u8, i: usize) bool {
+    if (i == 0 or text[i - 1] != 'R') return false;
+    var start = i - 1;
+    for ([_][]const u8{ "u8", "u", "U", "L" }) |prefix| {
+        if (std.mem.endsWith(u8, text[0..start], prefix)) {
+            start -= prefix.len;
+            break;
+        }
+    }
+    return start == 0 or !isIdentifier(text[start - 1]);
+}
+
+fn rawStringEnd(text: []const u8, i: usize) usize {
+    const open = std.mem.indexOfScalarPos(u8, text, i + 1, '(') orelse return i + 1;
+    const delimiter = text[i + 1 .. open];
+    var j = open + 1;
+    while (std.mem.indexOfPos(u8, text, j, ")")) |close| : (j = close + 1) {
+        const rest = text[close + 1 ..];
+        if (std.mem.startsWith(u8, rest, delimiter) and
+            rest.len > delimiter.len and rest[delimiter.len] == '"')
+        {
+            return close + 1 + delimiter.len + 1;
+        }
+    }
+    return i + 1;
+}
+
+fn isIdentifier(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '_' or c == '$';
+}
+
+fn expectStripped(expected: []const u8, text: []const u8) !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    try std.testing.expectEqualStrings(expected, try strip(arena_state.allocator(), text));
+}
+
+test "strip removes comments and collapses whitespace" {
+    try expectStripped("#define A 1\nint x;\n", "#define A  1 /* one */\nint   x; // x\n");
+    try expectStripped("int y;\nint z;\n", "   int y;   \n\tint z;\n");
+}
+
+test "strip keeps literals with escapes and comment markers" {
+    try expectStripped("char *s = \"a /* b \\\" // c\";\n", "char *s = \"a /* b \\\" // c\";\n");
+    try expectStripped("int q = '\\'' ;\n", "int q = '\\'' /* x */;\n");
+    try expectStripped("auto r = R\"x(/* a */ )\" )x\";\n", "auto r = R\"x(/* a */ )\" )x\";\n");
+}
+
+test "strip keeps line breaks inside comments and continuations" {
+    // The directive goes on past the comment, as it did before.
+    try expectStripped("#define B 2\\\n + 1\nB\n", "#define B 2 /* a\nb */ + 1\nB\n");
+    // A continued line comment stays one comment.
+    try expectStripped("\\\n\nx\n", "// a \\\n b\nx\n");
+    try expectStripped("#define C(x)\\\n (x)\n", "#define C(x) \\\n  (x)\n");
+}
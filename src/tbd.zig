@@ -0,0 +1,1177 @@
+//! Reads and writes TAPI v4 (YAML) and v5 (JSON) `.tbd` stubs, and writes
+//! and queries a symbol index built from them: for each target, every
+//! symbol the stubs export, sorted, with the install name of the library
+//! that exports it. The index is a flat little-endian file that can be
+//! memory-mapped and searched in place, so tools that need to know where a
+//! symbol comes from do not re-parse the stubs on every run.
+//!
+//! Importable from build scripts as `b.dependency("macos_sdk", .{}).module("tbd")`.
+const std = @import("std");
+
+/// One `--- !tapi-tbd` document: a library, or one of the sub-libraries
+/// an umbrella framework re-exports.
+pub const Document = struct {
+    install_name: []const u8 = "",
+    current_version: []const u8 = "1",
+    compatibility_version: []const u8 = "1",
+    swift_abi_version: ?[]const u8 = null,
+    /// Such as `arm64-macos` or `x86_64-maccatalyst`.
+    targets: []const []const u8 = &.{},
+    parent_umbrella: []const Umbrella = &.{},
+    allowable_clients: []const Clients = &.{},
+    reexported_libraries: []const Libraries = &.{},
+    /// Symbols the library defines.
+    exports: []const Symbols = &.{},
+    /// Symbols the library defines by re-exporting another library's.
+    reexports: []const Symbols = &.{},
+};
+
+pub const Umbrella = struct {
+    targets: []const []const u8 = &.{},
+    umbrella: []const u8 = "",
+};
+
+pub const Clients = struct {
+    targets: []const []const u8 = &.{},
+    clients: []const []const u8 = &.{},
+};
+
+pub const Libraries = struct {
+    targets: []const []const u8 = &.{},
+    libraries: []const []const u8 = &.{},
+};
+
+pub const Symbols = struct {
+    targets: []const []const u8 = &.{},
+    symbols: []const []const u8 = &.{},
+    weak_symbols: []const []const u8 = &.{},
+    /// Class names, e.g. `NSObject` for `_OBJC_CLASS_$_NSObject` and
+    /// `_OBJC_METACLASS_$_NSObject`.
+    objc_classes: []const []const u8 = &.{},
+    objc_eh_types: []const []const u8 = &.{},
+    /// `Class.ivar`.
+    objc_ivars: []const []const u8 = &.{},
+};
+
+pub const ParseError = error{ InvalidStub, UnsupportedStub, OutOfMemory };
+
+/// Parses every document of a stub, v4 or v5. Strings point into `text`
+/// or are allocated with `arena`.
+///
+/// Only the YAML that TAPI writes is accepted: keys at the start of a line
+/// or after `- `, plain or single-quoted scalars and flow lists (`[ a, b ]`)
+/// that may span lines. Unknown keys are skipped, as are unknown fields
+/// of JSON stubs.
+pub fn parse(arena: std.mem.Allocator, text: []const u8) ParseError![]const Document {
+    if (std.mem.indexOfNone(u8, text, " \t\r\n")) |start| {
+        if (text[start] == '{') return parseJson(arena, text);
+    }
+    var p: Parser = .{ .arena = arena, .text = text };
+    var documents = std.ArrayList(Document).init(arena);
+    while (p.pos < text.len) {
+        const line = p.restOfLine();
+        if (std.mem.startsWith(u8, line, "---")) {
+            const tag = std.mem.trim(u8, line[3..], " \r");
+            if (!std.mem.eql(u8, tag, "!tapi-tbd")) return error.UnsupportedStub;
+            p.nextLine();
+            if (p.indent() != 0) return error.InvalidStub;
+            const document = try p.mapping(Document, 0);
+            if (!std.mem.eql(u8, p.version, "4")) return error.UnsupportedStub;
+            p.version = "";
+            try documents.append(document);
+        } else {
+            p.nextLine();
+        }
+    }
+    return documents.items;
+}
+
+const Parser = struct {
+    arena: std.mem.Allocator,
+    text: []const u8,
+    pos: usize = 0,
+    /// The `tbd-version` of the current document.
+    version: []const u8 = "",
+
+    fn restOfLine(p: *Parser) []const u8 {
+        const end = std.mem.indexOfScalarPos(u8, p.text, p.pos, '\n') orelse p.text.len;
+        return p.text[p.pos..end];
+    }
+
+    fn nextLine(p: *Parser) void {
+        p.pos = if (std.mem.indexOfScalarPos(u8, p.text, p.pos, '\n')) |end| end + 1 else p.text.len;
+    }
+
+    /// The indentation of the line at `pos`, or null at the end of the
+    /// document or the text. Skips blank and comment lines.
+    fn indent(p: *Parser) ?usize {
+        while (p.pos < p.text.len) {
+            const line = p.restOfLine();
+            const column = std.mem.indexOfNone(u8, line, " ") orelse {
+                p.nextLine();
+                continue;
+            };
+            switch (line[column]) {
+                '\r', '#' => p.nextLine(),
+                else => {
+                    if (column == 0 and (std.mem.startsWith(u8, line, "---") or std.mem.startsWith(u8, line, "..."))) {
+                        return null;
+                    }
+                    return column;
+                },
+            }
+        }
+        return null;
+    }
+
+    /// Parses the keys at `column` into a `T`, starting at `pos`, which is
+    /// either the start of a line or just after `- `.
+    fn mapping(p: *Parser, comptime T: type, column: usize) ParseError!T {
+        var result: T = .{};
+        var first = true;
+        while (true) {
+            if (!first) {
+                const at = p.pos;
+                if (p.indent() != column) {
+                    p.pos = at;
+                    break;
+                }
+                p.pos += column;
+            }
+            first = false;
+
+            const key_end = std.mem.indexOfScalarPos(u8, p.text, p.pos, ':') orelse return error.InvalidStub;
+            const key = p.text[p.pos..key_end];
+            p.pos = key_end + 1;
+            p.skipSpaces();
+
+            var known = false;
+            inline for (std.meta.fields(T)) |field| {
+                if (!known and keyIs(key, field.name)) {
+                    known = true;
+                    @field(result, field.name) = try p.value(field.type, column);
+                }
+            }
+            if (!known) {
+                if (std.mem.eql(u8, key, "tbd-version")) {
+                    p.version = try p.scalar();
+                    p.nextLine();
+                } else try p.skipValue(column);
+            }
+        }
+        return result;
+    }
+
+    fn value(p: *Parser, comptime V: type, column: usize) ParseError!V {
+        switch (V) {
+            []const u8, ?[]const u8 => {
+                const s = try p.scalar();
+                p.nextLine();
+                return s;
+            },
+            []const []const u8 => {
+                const list = try p.flowList();
+                p.nextLine();
+                return list;
+            },
+            else => return p.sequence(@typeInfo(V).pointer.child, column),
+        }
+    }
+
+    /// A block sequence of mappings: lines of `- key: value`, indented
+    /// more than the key that holds it.
+    fn sequence(p: *Parser, comptime T: type, column: usize) ParseError![]const T {
+        if (p.pos < p.text.len and p.text[p.pos] != '\n' and p.text[p.pos] != '\r') return error.InvalidStub;
+        p.nextLine();
+        var items = std.ArrayList(T).init(p.arena);
+        const dash = p.indent() orelse return items.items;
+        if (dash <= column) return items.items;
+        while (true) {
+            const at = p.pos;
+            if (p.indent() != dash or !std.mem.startsWith(u8, p.text[p.pos + dash ..], "- ")) {
+                p.pos = at;
+                break;
+            }
+            p.pos += dash + 2;
+            try items.append(try p.mapping(T, dash + 2));
+        }
+        return items.items;
+    }
+
+    /// Skips a value and the lines indented under it.
+    fn skipValue(p: *Parser, column: usize) ParseError!void {
+        if (p.pos < p.text.len and p.text[p.pos] == '[') {
+            _ = try p.flowList();
+        }
+        p.nextLine();
+        while (true) {
+            const at = p.pos;
+            const next = p.indent() orelse break;
+            if (next <= column) {
+                p.pos = at;
+                break;
+            }
+            p.nextLine();
+        }
+    }
+
+    /// A plain or single-quoted scalar that ends the line.
+    fn scalar(p: *Parser) ParseError![]const u8 {
+        if (p.pos < p.text.len and p.text[p.pos] == '\'') return p.quoted();
+        const line = p.restOfLine();
+        const end = std.mem.indexOf(u8, line, " #") orelse line.len;
+        p.pos += end;
+        return std.mem.trimRight(u8, line[0..end], " \r");
+    }
+
+    fn flowList(p: *Parser) ParseError![]const []const u8 {
+        if (p.pos >= p.text.len or p.text[p.pos] != '[') return error.InvalidStub;
+        p.pos += 1;
+        var items = std.ArrayList([]const u8).init(p.arena);
+        while (true) {
+            p.pos = skipWhitespace(p.text, p.pos);
+            if (p.pos >= p.text.len) return error.InvalidStub;
+            if (p.text[p.pos] == ']') break;
+            if (p.text[p.pos] == '\'') {
+                try items.append(try p.quoted());
+            } else {
+                const end = plainEnd(p.text, p.pos);
+                if (end == p.pos) return error.InvalidStub;
+                try items.append(p.text[p.pos..end]);
+                p.pos = end;
+            }
+            p.pos = skipWhitespace(p.text, p.pos);
+            if (p.pos >= p.text.len) return error.InvalidStub;
+            switch (p.text[p.pos]) {
+                ',' => p.pos += 1,
+                ']' => break,
+                else => return error.InvalidStub,
+            }
+        }
+        p.pos += 1;
+        return items.items;
+    }
+
+    /// A single-quoted scalar, in which `''` stands for `'`.
+    fn quoted(p: *Parser) ParseError![]const u8 {
+        const start = p.pos + 1;
+        var end = start;
+        var escaped = false;
+        while (true) {
+            end = std.mem.indexOfScalarPos(u8, p.text, end, '\'') orelse return error.InvalidStub;
+            if (end + 1 < p.text.len and p.text[end + 1] == '\'') {
+                end += 2;
+                escaped = true;
+                continue;
+            }
+            break;
+        }
+        p.pos = end + 1;
+        const s = p.text[start..end];
+        if (!escaped) return s;
+        return std.mem.replaceOwned(u8, p.arena, s, "''", "'");
+    }
+
+    fn skipSpaces(p: *Parser) void {
+        while (p.pos < p.text.len and p.text[p.pos] == ' ') p.pos += 1;
+    }
+};
+
+/// Whether a YAML key such as `install-name` names the field
+/// `install_name`.
+fn keyIs(key: []const u8, comptime field: []const u8) bool {
+    if (key.len != field.len) return false;
+    for (key, field) |k, f| {
+        if (k != if (f == '_') '-' else f) return false;
+    }
+    return true;
+}
+
+const vector_len = std.simd.suggestVectorLength(u8) orelse 16;
+const Chunk = @Vector(vector_len, u8);
+
+/// The end of a plain scalar in a flow list: the next `,`, `]` or
+/// whitespace. Symbol lists are most of a stub's bytes, so this and
+/// `skipWhitespace` look at a vector of bytes at a time.
+fn plainEnd(text: []const u8, start: usize) usize {
+    var i = start;
+    while (i + vector_len <= text.len) : (i += vector_len) {
+        const chunk: Chunk = text[i..][0..vector_len].*;
+        const is_space = chunk <= @as(Chunk, @splat(' '));
+        const is_comma = chunk == @as(Chunk, @splat(','));
+        const is_close = chunk == @as(Chunk, @splat(']'));
+        const hits = @select(bool, is_space, is_space, @select(bool, is_comma, is_comma, is_close));
+        if (std.simd.firstTrue(hits)) |offset| return i + offset;
+    }
+    while (i < text.len and text[i] > ' ' and text[i] != ',' and text[i] != ']') i += 1;
+    return i;
+}
+
+/// Skips spaces and line breaks, such as the 20-odd spaces TAPI indents
+/// the continuation lines of a wrapped list by.
+fn skipWhitespace(text: []const u8, start: usize) usize {
+    var i = start;
+    while (i + vector_len <= text.len) : (i += vector_len) {
+        const chunk: Chunk = text[i..][0..vector_len].*;
+        if (std.simd.firstTrue(chunk > @as(Chunk, @splat(' ')))) |offset| return i + offset;
+    }
+    while (i < text.len and text[i] <= ' ') i += 1;
+    return i;
+}
+
+/// `AppKit` for `/System/Library/Frameworks/AppKit.framework/Versions/C/AppKit`.
+/// Null for frameworks nested in others and for private frameworks.
+pub fn frameworkName(install_name: []const u8) ?[]const u8 {
+    const prefix = "/System/Library/Frameworks/";
+    if (!std.mem.startsWith(u8, install_name, prefix)) return null;
+    const rest = install_name[prefix.len..];
+    const bundle = std.mem.indexOf(u8, rest, ".framework/") orelse return null;
+    const name = rest[0..bundle];
+    var components = std.mem.splitScalar(u8, rest[bundle + ".framework/".len ..], '/');
+    // Versions/<version>/<name>
+    if (!std.mem.eql(u8, components.next() orelse return null, "Versions")) return null;
+    _ = components.next() orelse return null;
+    if (!std.mem.eql(u8, components.next() orelse return null, name)) return null;
+    if (components.next() != null) return null;
+    return name;
+}
+
+/// Writes documents as a TAPI v4 stub that `parse` and ld64 read. Lists
+/// are written on one line rather than wrapped, and keys left at their
+/// defaults are left out.
+pub fn writeStub(documents: []const Document, writer: anytype) !void {
+    for (documents) |document| {
+        try writer.writeAll("--- !tapi-tbd\n");
+        try writeKey(writer, "tbd-version");
+        try writer.writeAll("4\n");
+        try writeField(writer, "targets", document.targets);
+        try writeField(writer, "install-name", document.install_name);
+        if (!std.mem.eql(u8, document.current_version, "1")) {
+            try writeField(writer, "current-version", document.current_version);
+        }
+        if (!std.mem.eql(u8, document.compatibility_version, "1")) {
+            try writeField(writer, "compatibility-version", document.compatibility_version);
+        }
+        if (document.swift_abi_version) |version| try writeField(writer, "swift-abi-version", version);
+        try writeItems(writer, "parent-umbrella", document.parent_umbrella);
+        try writeItems(writer, "allowable-clients", document.allowable_clients);
+        try writeItems(writer, "reexported-libraries", document.reexported_libraries);
+        try writeItems(writer, "exports", document.exports);
+        try writeItems(writer, "reexports", document.reexports);
+    }
+    try writer.writeAll("...\n");
+}
+
+fn writeItems(writer: anytype, key: []const u8, items: anytype) !void {
+    if (items.len == 0) return;
+    try writer.print("{s}:\n", .{key});
+    for (items) |item| {
+        var first = true;
+        inline for (std.meta.fields(@TypeOf(item))) |field| {
+            const value = @field(item, field.name);
+            const empty = switch (field.type) {
+                []const u8 => false,
+                else => value.len == 0,
+            };
+            if (!empty) {
+                try writer.writeAll(if (first) "  - " else "    ");
+                first = false;
+                var name: [field.name.len]u8 = field.name[0..field.name.len].*;
+                std.mem.replaceScalar(u8, &name, '_', '-');
+                try writeField(writer, &name, value);
+            }
+        }
+    }
+}
+
+/// Writes `key:` padded so values line up as in TAPI's output, then the
+/// value: a scalar or a flow list.
+fn writeField(writer: anytype, key: []const u8, value: anytype) !void {
+    try writeKey(writer, key);
+    switch (@TypeOf(value)) {
+        []const u8 => try writeScalar(writer, value),
+        []const []const u8 => {
+            try writer.writeAll("[ ");
+            for (value, 0..) |item, i| {
+                if (i > 0) try writer.writeAll(", ");
+                try writeScalar(writer, item);
+            }
+            try writer.writeAll(" ]");
+        },
+        else => @compileError("unsupported value type"),
+    }
+    try writer.writeByte('\n');
+}
+
+fn writeKey(writer: anytype, key: []const u8) !void {
+    try writer.print("{s}:", .{key});
+    try writer.writeByteNTimes(' ', @max(1, 16 -| key.len));
+}
+
+/// Writes a scalar plain if YAML would read it back as the same string,
+/// and single-quoted otherwise.
+fn writeScalar(writer: anytype, s: []const u8) !void {
+    if (isPlain(s)) return writer.writeAll(s);
+    try writer.writeByte('\'');
+    for (s) |c| {
+        if (c == '\'') try writer.writeByte('\'');
+        try writer.writeByte(c);
+    }
+    try writer.writeByte('\'');
+}
+
+fn isPlain(s: []const u8) bool {
+    if (s.len == 0 or s[0] == '-') return false;
+    for (s) |c| {
+        if (!std.ascii.isAlphanumeric(c) and c != '_' and c != '.' and c != '-') return false;
+    }
+    return true;
+}
+
+/// Writes documents as a TAPI v5 (JSON) stub that `parse` and ld64 read:
+/// the first as the main library, the others as its inline libraries.
+/// v4 does not record whether a symbol is code or data, so every symbol
+/// is listed under `text`, as TAPI does when it converts a v4 stub.
+pub fn writeJson(arena: std.mem.Allocator, documents: []const Document, writer: anytype) !void {
+    if (documents.len == 0) return error.InvalidStub;
+    const libraries = try arena.alloc(Json.Library, documents.len);
+    for (documents, libraries) |document, *library| library.* = try Json.from(arena, document);
+    const stub: Json = .{
+        .tapi_tbd_version = 5,
+        .main_library = libraries[0],
+        .libraries = if (libraries.len > 1) libraries[1..] else null,
+    };
+    try std.json.stringify(stub, .{ .emit_null_optional_fields = false }, writer);
+    try writer.writeByte('\n');
+}
+
+fn parseJson(arena: std.mem.Allocator, text: []const u8) ParseError![]const Document {
+    const stub = std.json.parseFromSliceLeaky(Json, arena, text, .{
+        .ignore_unknown_fields = true,
+    }) catch |err| switch (err) {
+        error.OutOfMemory => return error.OutOfMemory,
+        else => return error.InvalidStub,
+    };
+    if (stub.tapi_tbd_version != 5) return error.UnsupportedStub;
+    const libraries = stub.libraries orelse &.{};
+    const documents = try arena.alloc(Document, 1 + libraries.len);
+    documents[0] = try Json.document(arena, stub.main_library);
+    for (libraries, documents[1..]) |library, *document| document.* = try Json.document(arena, library);
+    return documents;
+}
+
+/// The parts of the TAPI v5 schema that `Document` covers. Lists left out
+/// are empty, and list items without `targets` apply to every target of
+/// their library.
+const Json = struct {
+    tapi_tbd_version: u32,
+    main_library: Library,
+    libraries: ?[]const Library = null,
+
+    const Library = struct {
+        target_info: []const struct { target: []const u8 },
+        install_names: []const struct { name: []const u8 },
+        current_versions: ?[]const Version = null,
+        compatibility_versions: ?[]const Version = null,
+        swift_abi: ?[]const struct { abi: u32 } = null,
+        parent_umbrellas: ?[]const struct { targets: ?[]const []const u8 = null, umbrella: []const u8 } = null,
+        allowable_clients: ?[]const struct { targets: ?[]const []const u8 = null, clients: []const []const u8 } = null,
+        reexported_libraries: ?[]const struct { targets: ?[]const []const u8 = null, names: []const []const u8 } = null,
+        exported_symbols: ?[]const SymbolList = null,
+        reexported_symbols: ?[]const SymbolList = null,
+    };
+
+    const Version = struct { version: []const u8 };
+
+    const SymbolList = struct {
+        targets: ?[]const []const u8 = null,
+        data: ?Section = null,
+        text: ?Section = null,
+    };
+
+    const Section = struct {
+        global: ?[]const []const u8 = null,
+        weak: ?[]const []const u8 = null,
+        objc_class: ?[]const []const u8 = null,
+        objc_eh_type: ?[]const []const u8 = null,
+        objc_ivar: ?[]const []const u8 = null,
+    };
+
+    /// The element type of the optional list `field` of `Library`.
+    fn Item(comptime field: []const u8) type {
+        return std.meta.Child(@typeInfo(@FieldType(Library, field)).optional.child);
+    }
+
+    fn from(arena: std.mem.Allocator, d: Document) !Library {
+        const target_info = try arena.alloc(std.meta.Child(@FieldType(Library, "target_info")), d.targets.len);
+        for (d.targets, target_info) |target, *info| info.* = .{ .target = target };
+        var library: Library = .{
+            .target_info = target_info,
+            .install_names = try arena.dupe(std.meta.Child(@FieldType(Library, "install_names")), &.{
+                .{ .name = d.install_name },
+            }),
+        };
+        if (!std.mem.eql(u8, d.current_version, "1")) {
+            library.current_versions = try arena.dupe(Version, &.{.{ .version = d.current_version }});
+        }
+        if (!std.mem.eql(u8, d.compatibility_version, "1")) {
+            library.compatibility_versions = try arena.dupe(Version, &.{.{ .version = d.compatibility_version }});
+        }
+        if (d.swift_abi_version) |version| {
+            const abi = std.fmt.parseInt(u32, version, 10) catch return error.InvalidStub;
+            library.swift_abi = try arena.dupe(Item("swift_abi"), &.{.{ .abi = abi }});
+        }
+        if (d.parent_umbrella.len > 0) {
+            const items = try arena.alloc(Item("parent_umbrellas"), d.parent_umbrella.len);
+            for (d.parent_umbrella, items) |x, *item| item.* = .{ .targets = x.targets, .umbrella = x.umbrella };
+            library.parent_umbrellas = items;
+        }
+        if (d.allowable_clients.len > 0) {
+            const items = try arena.alloc(Item("allowable_clients"), d.allowable_clients.len);
+            for (d.allowable_clients, items) |x, *item| item.* = .{ .targets = x.targets, .clients = x.clients };
+            library.allowable_clients = items;
+        }
+        if (d.reexported_libraries.len > 0) {
+            const items = try arena.alloc(Item("reexported_libraries"), d.reexported_libraries.len);
+            for (d.reexported_libraries, items) |x, *item| item.* = .{ .targets = x.targets, .names = x.libraries };
+            library.reexported_libraries = items;
+        }
+        library.exported_symbols = try symbolLists(arena, d.exports);
+        library.reexported_symbols = try symbolLists(arena, d.reexports);
+        return library;
+    }
+
+    fn symbolLists(arena: std.mem.Allocator, lists: []const Symbols) !?[]const SymbolList {
+        if (lists.len == 0) return null;
+        const items = try arena.alloc(SymbolList, lists.len);
+        for (lists, items) |list, *item| item.* = .{ .targets = list.targets, .text = .{
+            .global = nonEmpty(list.symbols),
+            .weak = nonEmpty(list.weak_symbols),
+            .objc_class = nonEmpty(list.objc_classes),
+            .objc_eh_type = nonEmpty(list.objc_eh_types),
+            .objc_ivar = nonEmpty(list.objc_ivars),
+        } };
+        return items;
+    }
+
+    fn nonEmpty(list: []const []const u8) ?[]const []const u8 {
+        return if (list.len == 0) null else list;
+    }
+
+    fn document(arena: std.mem.Allocator, library: Library) ParseError!Document {
+        if (library.install_names.len != 1) return error.InvalidStub;
+        const targets = try arena.alloc([]const u8, library.target_info.len);
+        for (library.target_info, targets) |info, *target| target.* = info.target;
+        var d: Document = .{ .install_name = library.install_names[0].name, .targets = targets };
+        if (library.current_versions) |versions| {
+            if (versions.len != 1) return error.InvalidStub;
+            d.current_version = versions[0].version;
+        }
+        if (library.compatibility_versions) |versions| {
+            if (versions.len != 1) return error.InvalidStub;
+            d.compatibility_version = versions[0].version;
+        }
+        if (library.swift_abi) |abis| {
+            if (abis.len != 1) return error.InvalidStub;
+            d.swift_abi_version = try std.fmt.allocPrint(arena, "{d}", .{abis[0].abi});
+        }
+        if (library.parent_umbrellas) |items| {
+            const list = try arena.alloc(Umbrella, items.len);
+            for (items, list) |item, *x| x.* = .{ .targets = item.targets orelse targets, .umbrella = item.umbrella };
+            d.parent_umbrella = list;
+        }
+        if (library.allowable_clients) |items| {
+            const list = try arena.alloc(Clients, items.len);
+            for (items, list) |item, *x| x.* = .{ .targets = item.targets orelse targets, .clients = item.clients };
+            d.allowable_clients = list;
+        }
+        if (library.reexported_libraries) |items| {
+            const list = try arena.alloc(Libraries, items.len);
+            for (items, list) |item, *x| x.* = .{ .targets = item.targets orelse targets, .libraries = item.names };
+            d.reexported_libraries = list;
+        }
+        d.exports = try symbols(arena, library.exported_symbols, targets);
+        d.reexports = try symbols(arena, library.reexported_symbols, targets);
+        return d;
+    }
+
+    /// Each list with its `data` and `text` symbols together.
+    fn symbols(arena: std.mem.Allocator, items: ?[]const SymbolList, targets: []const []const u8) ![]const Symbols {
+        const lists = try arena.alloc(Symbols, (items orelse return &.{}).len);
+        for (items.?, lists) |item, *list| {
+            const data = item.data orelse Section{};
+            const text = item.text orelse Section{};
+            list.* = .{
+                .targets = item.targets orelse targets,
+                .symbols = try concat(arena, data.global, text.global),
+                .weak_symbols = try concat(arena, data.weak, text.weak),
+                .objc_classes = try concat(arena, data.objc_class, text.objc_class),
+                .objc_eh_types = try concat(arena, data.objc_eh_type, text.objc_eh_type),
+                .objc_ivars = try concat(arena, data.objc_ivar, text.objc_ivar),
+            };
+        }
+        return lists;
+    }
+
+    fn concat(arena: std.mem.Allocator, a: ?[]const []const u8, b: ?[]const []const u8) ![]const []const u8 {
+        if (a == null) return b orelse &.{};
+        if (b == null) return a.?;
+        return std.mem.concat(arena, []const u8, &.{ a.?, b.? });
+    }
+};
+
+/// Writes the index of the symbols `documents` export for each of their
+/// targets. Documents with the same install name (a library stubbed under
+/// two names) are one library.
+///
+/// Layout, all integers little-endian `u32`:
+/// - header: magic `TBDI`, format version, target count, library count,
+///   symbol count, string table length
+/// - targets: name, index of the first symbol, symbol count
+/// - libraries: install name, sorted by it, and the library that lists
+///   it in `reexported-libraries` for any target, or `no_library`
+/// - symbols: name, library with `reexport_bit` set if the library lists
+///   the symbol under `reexports`; the symbols of each target are
+///   contiguous and sorted by name, then library
+/// - strings: NUL-terminated, referred to by offset
+pub fn writeIndex(gpa: std.mem.Allocator, documents: []const Document, writer: anytype) !void {
+    var arena_state = std.heap.ArenaAllocator.init(gpa);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    var strings = StringTable{};
+    var libraries: std.StringArrayHashMapUnmanaged(void) = .{};
+    for (documents) |document| try libraries.put(arena, document.install_name, {});
+    libraries.sort(struct {
+        keys: []const []const u8,
+        pub fn lessThan(ctx: @This(), a: usize, b: usize) bool {
+            return std.mem.lessThan(u8, ctx.keys[a], ctx.keys[b]);
+        }
+    }{ .keys = libraries.keys() });
+
+    const reexported_by = try arena.alloc(u32, libraries.count());
+    @memset(reexported_by, no_library);
+    for (documents) |document| {
+        const library: u32 = @intCast(libraries.getIndex(document.install_name).?);
+        for (document.reexported_libraries) |list| {
+            for (list.libraries) |name| {
+                const i = libraries.getIndex(name) orelse continue;
+                if (reexported_by[i] == no_library and i != library) reexported_by[i] = library;
+            }
+        }
+    }
+
+    const Entry = struct { name: []const u8, library: u32, reexport: bool };
+    var targets: std.StringArrayHashMapUnmanaged(std.ArrayListUnmanaged(Entry)) = .{};
+    for (documents) |document| {
+        const library: u32 = @intCast(libraries.getIndex(document.install_name).?);
+        for (document.targets) |target| {
+            const entries = try targets.getOrPut(arena, target);
+            if (!entries.found_existing) entries.value_ptr.* = .{};
+            for ([_][]const Symbols{ document.exports, document.reexports }, [_]bool{ false, true }) |lists, reexport| {
+                for (lists) |list| {
+                    if (!contains(list.targets, target)) continue;
+                    var names = SymbolNames{ .list = list };
+                    while (try names.next(arena)) |name| {
+                        try entries.value_ptr.append(arena, .{ .name = name, .library = library, .reexport = reexport });
+                    }
+                }
+            }
+        }
+    }
+    targets.sort(struct {
+        keys: []const []const u8,
+        pub fn lessThan(ctx: @This(), a: usize, b: usize) bool {
+            return std.mem.lessThan(u8, ctx.keys[a], ctx.keys[b]);
+        }
+    }{ .keys = targets.keys() });
+
+    var symbol_count: usize = 0;
+    for (targets.values()) |*entries| {
+        std.mem.sort(Entry, entries.items, {}, struct {
+            fn lessThan(_: void, a: Entry, b: Entry) bool {
+                return switch (std.mem.order(u8, a.name, b.name)) {
+                    .lt => true,
+                    .gt => false,
+                    .eq => a.library < b.library or
+                        (a.library == b.library and !a.reexport and b.reexport),
+                };
+            }
+        }.lessThan);
+        // A symbol listed twice for the same library, e.g. once per
+        // group of targets. Where it is both exported and re-exported,
+        // the export comes first and is kept.
+        var kept: usize = 0;
+        for (entries.items) |entry| {
+            if (kept > 0) {
+                const last = entries.items[kept - 1];
+                if (last.library == entry.library and std.mem.eql(u8, last.name, entry.name)) continue;
+            }
+            entries.items[kept] = entry;
+            kept += 1;
+        }
+        entries.shrinkRetainingCapacity(kept);
+        symbol_count += kept;
+    }
+
+    // Intern every string before writing the tables that refer to them.
+    for (targets.keys()) |name| _ = try strings.add(arena, name);
+    for (libraries.keys()) |name| _ = try strings.add(arena, name);
+    for (targets.values()) |entries| {
+        for (entries.items) |entry| _ = try strings.add(arena, entry.name);
+    }
+
+    try writeInts(writer, &.{
+        magic,
+        format_version,
+        @as(u32, @intCast(targets.count())),
+        @as(u32, @intCast(libraries.count())),
+        @as(u32, @intCast(symbol_count)),
+        @as(u32, @intCast(strings.bytes.items.len)),
+    });
+    var first: u32 = 0;
+    for (targets.keys(), targets.values()) |name, entries| {
+        try writeInts(writer, &.{ strings.offsets.get(name).?, first, @as(u32, @intCast(entries.items.len)) });
+        first += @intCast(entries.items.len);
+    }
+    for (libraries.keys(), reexported_by) |name, parent| try writeInts(writer, &.{ strings.offsets.get(name).?, parent });
+    for (targets.values()) |entries| {
+        for (entries.items) |entry| {
+            const library = if (entry.reexport) entry.library | reexport_bit else entry.library;
+            try writeInts(writer, &.{ strings.offsets.get(entry.name).?, library });
+        }
+    }
+    try writer.writeAll(strings.bytes.items);
+}
+
+const magic = std.mem.readInt(u32, "TBDI", .little);
+const format_version = 2;
+
+/// A library no library re-exports.
+const no_library = std.math.maxInt(u32);
+
+/// Set in a symbol's library for a symbol the library re-exports from
+/// another one, such as CoreServices re-exporting part of libm.
+const reexport_bit = 1 << 31;
+
+fn writeInts(writer: anytype, ints: []const u32) !void {
+    for (ints) |int| try writer.writeInt(u32, int, .little);
+}
+
+fn contains(list: []const []const u8, item: []const u8) bool {
+    for (list) |x| {
+        if (std.mem.eql(u8, x, item)) return true;
+    }
+    return false;
+}
+
+const StringTable = struct {
+    bytes: std.ArrayListUnmanaged(u8) = .{},
+    offsets: std.StringHashMapUnmanaged(u32) = .{},
+
+    fn add(table: *StringTable, arena: std.mem.Allocator, s: []const u8) !u32 {
+        const entry = try table.offsets.getOrPut(arena, s);
+        if (!entry.found_existing) {
+            entry.value_ptr.* = @intCast(table.bytes.items.len);
+            try table.bytes.appendSlice(arena, s);
+            try table.bytes.append(arena, 0);
+        }
+        return entry.value_ptr.*;
+    }
+};
+
+/// The names the linker sees for a list of symbols, with the Objective-C
+/// classes, EH types and ivars spelled as the symbols that define them.
+const SymbolNames = struct {
+    list: Symbols,
+    field: usize = 0,
+    item: usize = 0,
+    /// The metaclass of the last class, returned after it.
+    metaclass: ?[]const u8 = null,
+
+    fn next(it: *SymbolNames, arena: std.mem.Allocator) !?[]const u8 {
+        if (it.metaclass) |name| {
+            it.metaclass = null;
+            return try std.fmt.allocPrint(arena, "_OBJC_METACLASS_$_{s}", .{name});
+        }
+        const lists = [_][]const []const u8{
+            it.list.symbols,
+            it.list.weak_symbols,
+            it.list.objc_classes,
+            it.list.objc_eh_types,
+            it.list.objc_ivars,
+        };
+        while (it.field < lists.len) {
+            if (it.item == lists[it.field].len) {
+                it.field += 1;
+                it.item = 0;
+                continue;
+            }
+            const name = lists[it.field][it.item];
+            it.item += 1;
+            return switch (it.field) {
+                0, 1 => name,
+                2 => blk: {
+                    it.metaclass = name;
+                    break :blk try std.fmt.allocPrint(arena, "_OBJC_CLASS_$_{s}", .{name});
+                },
+                3 => try std.fmt.allocPrint(arena, "_OBJC_EHTYPE_$_{s}", .{name}),
+                4 => try std.fmt.allocPrint(arena, "_OBJC_IVAR_$_{s}", .{name}),
+                else => unreachable,
+            };
+        }
+        return null;
+    }
+};
+
+/// An index written by `writeIndex`, read in place. Lookups are a binary
+/// search over the target's symbols and allocate nothing.
+pub const Index = struct {
+    bytes: []const u8,
+    target_count: u32,
+    library_count: u32,
+    symbol_count: u32,
+    strings: []const u8,
+
+    const header_len = 6 * 4;
+    const target_len = 3 * 4;
+    const library_len = 2 * 4;
+    const symbol_len = 2 * 4;
+
+    pub fn init(bytes: []const u8) error{InvalidIndex}!Index {
+        if (bytes.len < header_len) return error.InvalidIndex;
+        if (readU32(bytes, 0) != magic or readU32(bytes, 4) != format_version) return error.InvalidIndex;
+        const index: Index = .{
+            .bytes = bytes,
+            .target_count = readU32(bytes, 8),
+            .library_count = readU32(bytes, 12),
+            .symbol_count = readU32(bytes, 16),
+            .strings = &.{},
+        };
+        const tables_len = @as(u64, index.target_count) * target_len +
+            @as(u64, index.library_count) * library_len +
+            @as(u64, index.symbol_count) * symbol_len;
+        const strings_len = readU32(bytes, 20);
+        if (header_len + tables_len + strings_len != bytes.len) return error.InvalidIndex;
+        var result = index;
+        result.strings = bytes[bytes.len - strings_len ..];
+        return result;
+    }
+
+    /// The libraries that export `symbol` (with its leading underscore,
+    /// as in the stubs) for `target` (e.g. `arm64-macos`), in install name
+    /// order.
+    pub fn exporters(index: Index, target: []const u8, symbol: []const u8) Exporters {
+        const range = index.targetSymbols(target) orelse return .{ .index = index, .i = 0, .end = 0 };
+        var lo = range.first;
+        var hi = range.first + range.count;
+        while (lo < hi) {
+            const mid = lo + (hi - lo) / 2;
+            if (std.mem.lessThan(u8, index.symbolName(mid), symbol)) lo = mid + 1 else hi = mid;
+        }
+        var end = lo;
+        while (end < range.first + range.count and std.mem.eql(u8, index.symbolName(end), symbol)) end += 1;
+        return .{ .index = index, .i = lo, .end = end };
+    }
+
+    /// The install name of the first library that defines `symbol` for
+    /// `target`, or failing that of the first that re-exports it. Null if
+    /// none exports it.
+    pub fn lookup(index: Index, target: []const u8, symbol: []const u8) ?[]const u8 {
+        var it = index.exporters(target, symbol);
+        var reexporter: ?[]const u8 = null;
+        while (it.next()) |exporter| {
+            if (!exporter.reexport) return exporter.install_name;
+            if (reexporter == null) reexporter = exporter.install_name;
+        }
+        return reexporter;
+    }
+
+    pub const Exporter = struct {
+        install_name: []const u8,
+        /// The library only re-exports the symbol from another one.
+        reexport: bool,
+    };
+
+    pub const Exporters = struct {
+        index: Index,
+        i: u32,
+        end: u32,
+
+        pub fn next(it: *Exporters) ?Exporter {
+            if (it.i == it.end) return null;
+            defer it.i += 1;
+            const library = readU32(it.index.bytes, it.index.symbolOffset(it.i) + 4);
+            if (library & ~@as(u32, reexport_bit) >= it.index.library_count) return null;
+            return .{
+                .install_name = it.index.libraryName(library & ~@as(u32, reexport_bit)),
+                .reexport = library & reexport_bit != 0,
+            };
+        }
+    };
+
+    /// The install name of the library that re-exports `install_name`,
+    /// such as CoreServices for its sub-framework CarbonCore or AppKit for
+    /// the private UIFoundation, or null if there is none in the SDK.
+    pub fn reexportedBy(index: Index, install_name: []const u8) ?[]const u8 {
+        var lo: u32 = 0;
+        var hi = index.library_count;
+        while (lo < hi) {
+            const mid = lo + (hi - lo) / 2;
+            if (std.mem.lessThan(u8, index.libraryName(mid), install_name)) lo = mid + 1 else hi = mid;
+        }
+        if (lo == index.library_count or !std.mem.eql(u8, index.libraryName(lo), install_name)) return null;
+        const parent = readU32(index.bytes, index.libraryOffset(lo) + 4);
+        if (parent >= index.library_count) return null;
+        return index.libraryName(parent);
+    }
+
+    /// The name of the `i`th target the index covers, from 0 to
+    /// `target_count`.
+    pub fn targetName(index: Index, i: u32) []const u8 {
+        return index.string(readU32(index.bytes, header_len + i * target_len));
+    }
+
+    fn targetSymbols(index: Index, name: []const u8) ?struct { first: u32, count: u32 } {
+        var i: u32 = 0;
+        while (i < index.target_count) : (i += 1) {
+            if (!std.mem.eql(u8, index.targetName(i), name)) continue;
+            const at = header_len + i * target_len;
+            const first = readU32(index.bytes, at + 4);
+            const count = readU32(index.bytes, at + 8);
+            if (@as(u64, first) + count > index.symbol_count) return null;
+            return .{ .first = first, .count = count };
+        }
+        return null;
+    }
+
+    fn libraryOffset(index: Index, i: u32) usize {
+        return header_len + @as(usize, index.target_count) * target_len + @as(usize, i) * library_len;
+    }
+
+    fn libraryName(index: Index, i: u32) []const u8 {
+        return index.string(readU32(index.bytes, index.libraryOffset(i)));
+    }
+
+    fn symbolOffset(index: Index, i: u32) usize {
+        return index.libraryOffset(index.library_count) + @as(usize, i) * symbol_len;
+    }
+
+    fn symbolName(index: Index, i: u32) []const u8 {
+        return index.string(readU32(index.bytes, index.symbolOffset(i)));
+    }
+
+    /// Out of range offsets read as the empty string rather than
+    /// trusting the file.
+    fn string(index: Index, offset: u32) []const u8 {
+        if (offset >= index.strings.len) return "";
+        return std.mem.sliceTo(index.strings[offset..], 0);
+    }
+};
+
+fn readU32(bytes: []const u8, offset: usize) u32 {
+    return std.mem.readInt(u32, bytes[offset..][0..4], .little);
+}
+
+/// An index file mapped into memory.
+pub const MappedIndex = struct {
+    index: Index,
+    memory: []align(std.heap.page_size_min) const u8,
+
+    pub fn open(dir: std.fs.Dir, sub_path: []const u8) !MappedIndex {
+        const file = try dir.openFile(sub_path, .{});
+        defer file.close();
+        const size = (try file.stat()).size;
+        if (size == 0) return error.InvalidIndex;
+        const memory = try std.posix.mmap(null, size, std.posix.PROT.READ, .{ .TYPE = .PRIVATE }, file.handle, 0);
+        errdefer std.posix.munmap(memory);
+        return .{ .index = try Index.init(memory), .memory = memory };
+    }
+
+    pub fn close(mapped: MappedIndex) void {
+        std.posix.munmap(mapped.memory);
+    }
+};
+
+const test_stub =
+    \\# A comment before the first document is skipped.
+    \\--- !tapi-tbd
+    \\tbd-version:     4
+    \\targets:         [ x86_64-macos, arm64-macos ]
+    \\install-name:    '/System/Library/Frameworks/Foo.framework/Versions/A/Foo'
+    \\current-version: 1.2
+    \\reexported-libraries:
+    \\  - targets:         [ x86_64-macos, arm64-macos ]
+    \\    libraries:       [ '/System/Library/Frameworks/Foo.framework/Versions/A/Frameworks/Bar.framework/Versions/A/Bar' ]
+    \\exports:
+    \\  - targets:         [ x86_64-macos, arm64-macos ]
+    \\    symbols:         [ _FooMain,
+    \\                       _kFooVersion ]
+    \\    objc-classes:    [ FooView ]
+    \\  - targets:         [ arm64-macos ]
+    \\    symbols:         [ '_foo''s' ]
+    \\--- !tapi-tbd
+    \\tbd-version:     4
+    \\targets:         [ x86_64-macos, arm64-macos ]
+    \\install-name:    '/System/Library/Frameworks/Foo.framework/Versions/A/Frameworks/Bar.framework/Versions/A/Bar'
+    \\exports:
+    \\  - targets:         [ x86_64-macos, arm64-macos ]
+    \\    symbols:         [ _BarRun, _FooMain ]
+    \\reexports:
+    \\  - targets: [ arm64-macos ]
+    \\    symbols: [ _shared ]
+    \\...
+    \\
+;
+const test_foo = "/System/Library/Frameworks/Foo.framework/Versions/A/Foo";
+const test_bar = "/System/Library/Frameworks/Foo.framework/Versions/A/Frameworks/Bar.framework/Versions/A/Bar";
+
+test "parse reads every document of a stub" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const documents = try parse(arena_state.allocator(), test_stub);
+
+    try std.testing.expectEqual(2, documents.len);
+    const foo = documents[0];
+    try std.testing.expectEqualStrings(test_foo, foo.install_name);
+    try std.testing.expectEqualStrings("1.2", foo.current_version);
+    try std.testing.expectEqualStrings("1", foo.compatibility_version);
+    try std.testing.expectEqual(2, foo.targets.len);
+    try std.testing.expectEqualStrings("arm64-macos", foo.targets[1]);
+    try std.testing.expectEqual(1, foo.reexported_libraries.len);
+    try std.testing.expectEqualStrings(test_bar, foo.reexported_libraries[0].libraries[0]);
+    try std.testing.expectEqual(2, foo.exports.len);
+    try std.testing.expectEqual(2, foo.exports[0].symbols.len);
+    try std.testing.expectEqualStrings("_kFooVersion", foo.exports[0].symbols[1]);
+    try std.testing.expectEqualStrings("FooView", foo.exports[0].objc_classes[0]);
+    try std.testing.expectEqual(0, foo.reexports.len);
+
+    const bar = documents[1];
+    try std.testing.expectEqualStrings(test_bar, bar.install_name);
+    try std.testing.expectEqual(1, bar.reexports.len);
+    try std.testing.expectEqualStrings("_shared", bar.reexports[0].symbols[0]);
+}
+
+test "parse reads quoted scalars and flow lists" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    // Symbols longer than a vector and runs of whitespace that span
+    // several, so that plainEnd and skipWhitespace take both paths.
+    const long = "__ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE6appendEPKcm" ** 2;
+    const text = "--- !tapi-tbd\n" ++
+        "tbd-version: 4\n" ++
+        "targets: [arm64-macos]\n" ++
+        "install-name: /usr/lib/libtest.dylib # trailing comment\n" ++
+        "swift-abi-version: '7'\n" ++
+        "exports:\n" ++
+        "  - targets: [ arm64-macos ]\n" ++
+        "    symbols: [ 'it''s', 'a, b]', " ++ long ++ "," ++ (" " ** 80) ++ "\n" ++
+        (" " ** 70) ++ "_last ]\n" ++
+        "    weak-symbols: [ ]\n" ++
+        "    objc-ivars: [ Foo._bar ]\n" ++
+        "...\n";
+
+    const documents = try parse(arena_state.allocator(), text);
+    try std.testing.expectEqual(1, documents.len);
+    const d = documents[0];
+    try std.testing.expectEqualStrings("/usr/lib/libtest.dylib", d.install_name);
+    try std.testing.expectEqualStrings("7", d.swift_abi_version.?);
+    try std.testing.expectEqualStrings("arm64-macos", d.targets[0]);
+    const symbols = d.exports[0].symbols;
+    try std.testing.expectEqual(4, symbols.len);
+    try std.testing.expectEqualStrings("it's", symbols[0]);
+    try std.testing.expectEqualStrings("a, b]", symbols[1]);
+    try std.testing.expectEqualStrings(long, symbols[2]);
+    try std.testing.expectEqualStrings("_last", symbols[3]);
+    try std.testing.expectEqual(0, d.exports[0].weak_symbols.len);
+    try std.testing.expectEqualStrings("Foo._bar", d.exports[0].objc_ivars[0]);
+
+    try std.testing.expectEqual(long.len, plainEnd(long ++ ",", 0));
+    try std.testing.expectEqual(100, skipWhitespace((" \n" ** 50) ++ "x", 0));
+    try std.testing.expectError(error.InvalidStub, parse(arena_state.allocator(), "--- !tapi-tbd\ntargets: [ a, b\n"));
+    try std.testing.expectError(error.UnsupportedStub, parse(arena_state.allocator(), "--- !tapi-tbd-v3\n"));
+}
+
+test "writeStub and writeJson round-trip through parse" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+    const original = try parse(arena, test_stub);
+
+    var v4 = std.ArrayList(u8).init(arena);
+    try writeStub(original, v4.writer());
+    try std.testing.expectEqualDeep(original, try parse(arena, v4.items));
+
+    var v5 = std.ArrayList(u8).init(arena);
+    try writeJson(arena, original, v5.writer());
+    try std.testing.expectEqualDeep(original, try parse(arena, v5.items));
+}
+
+test "writeJson writes the TAPI v5 schema" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    // Written out by hand from the TAPI v5 schema, so that a mistake
+    // `writeJson` and `parse` share cannot hide behind the round trip.
+    // Every symbol is `text`: v4 does not say which are data.
+    const both = "\"targets\":[\"x86_64-macos\",\"arm64-macos\"]";
+    const target_info = "\"target_info\":[{\"target\":\"x86_64-macos\"},{\"target\":\"arm64-macos\"}]";
+    const expected = "{\"tapi_tbd_version\":5,\"main_library\":{" ++
+        target_info ++ ",\"install_names\":[{\"name\":\"" ++ test_foo ++ "\"}]," ++
+        "\"current_versions\":[{\"version\":\"1.2\"}]," ++
+        "\"reexported_libraries\":[{" ++ both ++ ",\"names\":[\"" ++ test_bar ++ "\"]}]," ++
+        "\"exported_symbols\":[" ++
+        "{" ++ both ++ ",\"text\":{\"global\":[\"_FooMain\",\"_kFooVersion\"],\"objc_class\":[\"FooView\"]}}," ++
+        "{\"targets\":[\"arm64-macos\"],\"text\":{\"global\":[\"_foo's\"]}}]}," ++
+        "\"libraries\":[{" ++
+        target_info ++ ",\"install_names\":[{\"name\":\"" ++ test_bar ++ "\"}]," ++
+        "\"exported_symbols\":[{" ++ both ++ ",\"text\":{\"global\":[\"_BarRun\",\"_FooMain\"]}}]," ++
+        "\"reexported_symbols\":[{\"targets\":[\"arm64-macos\"],\"text\":{\"global\":[\"_shared\"]}}]}]}\n";
+
+    var v5 = std.ArrayList(u8).init(arena);
+    try writeJson(arena, try parse(arena, test_stub), v5.writer());
+    try std.testing.expectEqualStrings(expected, v5.items);
+}
+
+test "Index looks up exporters and re-exporting libraries" {
+    var arena_state = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    var bytes = std.ArrayList(u8).init(arena);
+    try writeIndex(std.testing.allocator, try parse(arena, test_stub), bytes.writer());
+    const index = try Index.init(bytes.items);
+
+    try std.testing.expectEqual(2, index.target_count);
+    try std.testing.expectEqualStrings("arm64-macos", index.targetName(0));
+    // Both define it; the first by install name wins.
+    try std.testing.expectEqualStrings(test_foo, index.lookup("x86_64-macos", "_FooMain").?);
+    try std.testing.expectEqualStrings(test_bar, index.lookup("x86_64-macos", "_BarRun").?);
+    try std.testing.expectEqualStrings(test_foo, index.lookup("arm64-macos", "_foo's").?);
+    try std.testing.expectEqual(null, index.lookup("x86_64-macos", "_foo's"));
+    try std.testing.expectEqualStrings(test_foo, index.lookup("arm64-macos", "_OBJC_CLASS_$_FooView").?);
+    try std.testing.expectEqualStrings(test_foo, index.lookup("arm64-macos", "_OBJC_METACLASS_$_FooView").?);
+    try std.testing.expectEqual(null, index.lookup("arm64-macos", "_missing"));
+    try std.testing.expectEqual(null, index.lookup("riscv64-linux", "_FooMain"));
+
+    var exporters = index.exporters("arm64-macos", "_shared");
+    const shared = exporters.next().?;
+    try std.testing.expectEqualStrings(test_bar, shared.install_name);
+    try std.testing.expect(shared.reexport);
+    try std.testing.expectEqual(null, exporters.next());
+    try std.testing.expectEqualStrings(test_bar, index.lookup("arm64-macos", "_shared").?);
+
+    try std.testing.expectEqualStrings(test_foo, index.reexportedBy(test_bar).?);
+    try std.testing.expectEqual(null, index.reexportedBy(test_foo));
+    try std.testing.expectEqual(null, index.reexportedBy("/usr/lib/libnone.dylib"));
+
+    try std.testing.expectError(error.InvalidIndex, Index.init(bytes.items[0 .. bytes.items.len - 1]));
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+    try tmp.dir.writeFile(.{ .sub_path = "sdk.tbdi", .data = bytes.items });
+    const mapped = try MappedIndex.open(tmp.dir, "sdk.tbdi");
+    defer mapped.close();
+    try std.testing.expectEqualStrings(test_bar, mapped.index.lookup("arm64-macos", "_BarRun").?);
+}
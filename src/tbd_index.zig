@@ -0,0 +1,60 @@
+//! Parses every `.tbd` stub under the given directories and writes the
+//! symbol index described in `tbd.zig`.
+//!
+//! Usage: tbd_index <out.tbdi> <out.d> <dir>...
+//!
+//! Symlinked stubs (`libobjc.tbd -> libobjc.A.tbd`, `Versions/Current`)
+//! are read once, through their target. The stubs read are listed in
+//! `<out.d>`.
+const std = @import("std");
+const tbd = @import("tbd");
+const DepFile = @import("dep_file").DepFile;
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 4) {
+        std.log.err("usage: {s} <out.tbdi> <out.d> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var paths = std.ArrayList([]const u8).init(arena);
+    for (args[3..]) |arg| {
+        const dir_path = try std.fs.cwd().realpathAlloc(arena, arg);
+        var dir = try std.fs.openDirAbsolute(dir_path, .{ .iterate = true });
+        defer dir.close();
+        var walker = try dir.walk(arena);
+        defer walker.deinit();
+        while (try walker.next()) |entry| {
+            if (entry.kind != .file or !std.mem.endsWith(u8, entry.basename, ".tbd")) continue;
+            try paths.append(try std.fs.path.join(arena, &.{ dir_path, entry.path }));
+        }
+    }
+    std.mem.sort([]const u8, paths.items, {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+
+    var deps = DepFile.init(arena);
+    var documents = std.ArrayList(tbd.Document).init(arena);
+    for (paths.items) |path| {
+        const text = try std.fs.cwd().readFileAlloc(arena, path, std.math.maxInt(u32));
+        try deps.add(path);
+        const parsed = tbd.parse(arena, text) catch |err| {
+            std.log.err("{s}: {s}", .{ path, @errorName(err) });
+            std.process.exit(1);
+        };
+        try documents.appendSlice(parsed);
+    }
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    try tbd.writeIndex(arena, documents.items, buf.writer());
+    try buf.flush();
+    try deps.write(args[2]);
+}
@@ -0,0 +1,204 @@
+//! Checks that stubs converted by `tbd_v5` export the same symbols as the
+//! originals: for every target, the same symbols from the same install
+//! names, with the same kind (export, weak or re-export).
+//!
+//! Usage: tbd_roundtrip <v4-dir> <v5-dir>
+//!
+//! Every stub under `<v4-dir>` is compared with the stub at the same path
+//! under `<v5-dir>`, which must be JSON. Prints the first differences and
+//! exits with 1 if there are any.
+//!
+//! The v5 side is read with `std.json` rather than `tbd.parse`, so that a
+//! mistake shared by `tbd.writeJson` and the JSON reader of `tbd.parse`
+//! does not cancel out.
+const std = @import("std");
+const tbd = @import("tbd");
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 3) {
+        std.log.err("usage: {s} <v4-dir> <v5-dir>", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var v4 = try std.fs.cwd().openDir(args[1], .{ .iterate = true });
+    defer v4.close();
+    var v5 = try std.fs.cwd().openDir(args[2], .{});
+    defer v5.close();
+
+    var failed = false;
+    var walker = try v4.walk(arena);
+    defer walker.deinit();
+    while (try walker.next()) |entry| {
+        if (entry.kind != .file or !std.mem.endsWith(u8, entry.basename, ".tbd")) continue;
+        const original = try v4.readFileAlloc(arena, entry.path, std.math.maxInt(u32));
+        const converted = v5.readFileAlloc(arena, entry.path, std.math.maxInt(u32)) catch |err| {
+            std.log.err("{s}: {s}", .{ entry.path, @errorName(err) });
+            failed = true;
+            continue;
+        };
+        if (!std.mem.startsWith(u8, converted, "{")) {
+            std.log.err("{s}: not converted to JSON", .{entry.path});
+            failed = true;
+            continue;
+        }
+        const expected = try symbolLines(arena, parse(arena, entry.path, original));
+        const actual = jsonSymbolLines(arena, converted) catch |err| {
+            std.log.err("{s}: {s}", .{ entry.path, @errorName(err) });
+            failed = true;
+            continue;
+        };
+        if (!compare(entry.path, expected, actual)) failed = true;
+    }
+    if (failed) std.process.exit(1);
+}
+
+fn parse(arena: std.mem.Allocator, path: []const u8, text: []const u8) []const tbd.Document {
+    return tbd.parse(arena, text) catch |err| {
+        std.log.err("{s}: {s}", .{ path, @errorName(err) });
+        std.process.exit(1);
+    };
+}
+
+/// `<target> <install-name> <kind> <symbol>` for every symbol exported by
+/// `documents`, sorted. Objective-C names get their symbol prefixes.
+fn symbolLines(arena: std.mem.Allocator, documents: []const tbd.Document) ![]const []const u8 {
+    const Kind = struct { names: []const []const u8, kind: []const u8, prefixes: []const []const u8 };
+    var lines = std.ArrayList([]const u8).init(arena);
+    for (documents) |document| {
+        for ([_][]const tbd.Symbols{ document.exports, document.reexports }, [_][]const u8{ "export", "reexport" }) |lists, kind| {
+            for (lists) |list| {
+                for (list.targets) |target| {
+                    const kinds = [_]Kind{
+                        .{ .names = list.symbols, .kind = kind, .prefixes = &.{""} },
+                        .{ .names = list.weak_symbols, .kind = "weak", .prefixes = &.{""} },
+                        .{ .names = list.objc_classes, .kind = kind, .prefixes = &.{ "_OBJC_CLASS_$_", "_OBJC_METACLASS_$_" } },
+                        .{ .names = list.objc_eh_types, .kind = kind, .prefixes = &.{"_OBJC_EHTYPE_$_"} },
+                        .{ .names = list.objc_ivars, .kind = kind, .prefixes = &.{"_OBJC_IVAR_$_"} },
+                    };
+                    for (kinds) |k| {
+                        for (k.names) |name| {
+                            for (k.prefixes) |prefix| try lines.append(try std.fmt.allocPrint(arena, "{s} {s} {s} {s}{s}", .{
+                                target, document.install_name, k.kind, prefix, name,
+                            }));
+                        }
+                    }
+                }
+            }
+        }
+    }
+    sort(lines.items);
+    return lines.items;
+}
+
+/// `symbolLines` of a v5 stub, read straight from its JSON: the
+/// `data` and `text` sections of every symbol list of the main library
+/// and of the inline libraries.
+fn jsonSymbolLines(arena: std.mem.Allocator, text: []const u8) ![]const []const u8 {
+    const Kind = struct { field: []const u8, kind: ?[]const u8, prefixes: []const []const u8 };
+    const kinds = [_]Kind{
+        .{ .field = "global", .kind = null, .prefixes = &.{""} },
+        .{ .field = "weak", .kind = "weak", .prefixes = &.{""} },
+        .{ .field = "objc_class", .kind = null, .prefixes = &.{ "_OBJC_CLASS_$_", "_OBJC_METACLASS_$_" } },
+        .{ .field = "objc_eh_type", .kind = null, .prefixes = &.{"_OBJC_EHTYPE_$_"} },
+        .{ .field = "objc_ivar", .kind = null, .prefixes = &.{"_OBJC_IVAR_$_"} },
+    };
+    const stub = try std.json.parseFromSliceLeaky(std.json.Value, arena, text, .{});
+    var libraries = std.ArrayList(std.json.Value).init(arena);
+    try libraries.append(member(stub, "main_library"));
+    try libraries.appendSlice(items(member(stub, "libraries")));
+
+    var lines = std.ArrayList([]const u8).init(arena);
+    for (libraries.items) |library| {
+        const install_names = items(member(library, "install_names"));
+        if (install_names.len != 1) return error.InvalidStub;
+        const install_name = try string(member(install_names[0], "name"));
+        var library_targets = std.ArrayList([]const u8).init(arena);
+        for (items(member(library, "target_info"))) |info| try library_targets.append(try string(member(info, "target")));
+
+        for ([_][]const u8{ "exported_symbols", "reexported_symbols" }, [_][]const u8{ "export", "reexport" }) |field, kind| {
+            for (items(member(library, field))) |list| {
+                var targets = library_targets.items;
+                if (member(list, "targets") == .array) {
+                    var list_targets = std.ArrayList([]const u8).init(arena);
+                    for (items(member(list, "targets"))) |target| try list_targets.append(try string(target));
+                    targets = list_targets.items;
+                }
+                for (targets) |target| {
+                    for ([_][]const u8{ "data", "text" }) |section| {
+                        for (kinds) |k| {
+                            for (items(member(member(list, section), k.field))) |name| {
+                                for (k.prefixes) |prefix| try lines.append(try std.fmt.allocPrint(arena, "{s} {s} {s} {s}{s}", .{
+                                    target, install_name, k.kind orelse kind, prefix, try string(name),
+                                }));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    sort(lines.items);
+    return lines.items;
+}
+
+/// The member `name` of an object, or null if there is none.
+fn member(value: std.json.Value, name: []const u8) std.json.Value {
+    if (value != .object) return .null;
+    return value.object.get(name) orelse .null;
+}
+
+/// The elements of an array; none for null.
+fn items(value: std.json.Value) []const std.json.Value {
+    return if (value == .array) value.array.items else &.{};
+}
+
+fn string(value: std.json.Value) ![]const u8 {
+    return if (value == .string) value.string else error.InvalidStub;
+}
+
+fn sort(lines: [][]const u8) void {
+    std.mem.sort([]const u8, lines, {}, struct {
+        fn lessThan(_: void, a: []const u8, b: []const u8) bool {
+            return std.mem.lessThan(u8, a, b);
+        }
+    }.lessThan);
+}
+
+/// Logs up to ten lines that only one side has. Returns whether there
+/// were none.
+fn compare(path: []const u8, expected: []const []const u8, actual: []const []const u8) bool {
+    var i: usize = 0;
+    var j: usize = 0;
+    var differences: usize = 0;
+    while (i < expected.len or j < actual.len) {
+        const order: std.math.Order = if (i == expected.len)
+            .gt
+        else if (j == actual.len)
+            .lt
+        else
+            std.mem.order(u8, expected[i], actual[j]);
+        switch (order) {
+            .eq => {
+                i += 1;
+                j += 1;
+                continue;
+            },
+            .lt => {
+                if (differences < 10) std.log.err("{s}: missing {s}", .{ path, expected[i] });
+                i += 1;
+            },
+            .gt => {
+                if (differences < 10) std.log.err("{s}: extra {s}", .{ path, actual[j] });
+                j += 1;
+            },
+        }
+        differences += 1;
+    }
+    if (differences > 10) std.log.err("{s}: {d} differences", .{ path, differences });
+    return differences == 0;
+}
@@ -0,0 +1,76 @@
+//! Converts directories of TAPI v4 `.tbd` stubs to v5 (JSON), which ld64
+//! and `tbd.parse` read without a YAML parser.
+//!
+//! Usage: tbd_v5 <out-dir> <out.d> <dir>...
+//!
+//! Each dir is mirrored to `<out-dir>/<basename>` with only its stubs and
+//! symlinks, which are copied as they are. Header, module and resource
+//! directories are left out. The stubs read are listed in `<out.d>`.
+const std = @import("std");
+const tbd = @import("tbd");
+const DepFile = @import("dep_file").DepFile;
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 4) {
+        std.log.err("usage: {s} <out-dir> <out.d> <dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    var out = try std.fs.cwd().makeOpenPath(args[1], .{});
+    defer out.close();
+    var deps = DepFile.init(arena);
+    for (args[3..]) |arg| {
+        const path = try std.fs.cwd().realpathAlloc(arena, arg);
+        var src = try std.fs.openDirAbsolute(path, .{ .iterate = true });
+        defer src.close();
+        var dst = try out.makeOpenPath(std.fs.path.basename(path), .{});
+        defer dst.close();
+        try convert(arena, src, path, dst, &deps);
+    }
+    try deps.write(args[2]);
+}
+
+/// Directories that hold no stubs.
+const skipped_dirs = [_][]const u8{ "Headers", "PrivateHeaders", "Modules", "Resources" };
+
+fn convert(arena: std.mem.Allocator, src: std.fs.Dir, path: []const u8, dst: std.fs.Dir, deps: *DepFile) !void {
+    var it = src.iterate();
+    while (try it.next()) |entry| {
+        for (skipped_dirs) |name| {
+            if (std.mem.eql(u8, entry.name, name)) break;
+        } else switch (entry.kind) {
+            .directory => {
+                var sub_src = try src.openDir(entry.name, .{ .iterate = true });
+                defer sub_src.close();
+                var sub_dst = try dst.makeOpenPath(entry.name, .{});
+                defer sub_dst.close();
+                try convert(arena, sub_src, try std.fs.path.join(arena, &.{ path, entry.name }), sub_dst, deps);
+            },
+            .sym_link => {
+                var buf: [std.fs.max_path_bytes]u8 = undefined;
+                dst.symLink(try src.readLink(entry.name, &buf), entry.name, .{}) catch |err| switch (err) {
+                    error.PathAlreadyExists => {},
+                    else => return err,
+                };
+            },
+            .file => {
+                if (!std.mem.endsWith(u8, entry.name, ".tbd")) continue;
+                const text = try src.readFileAlloc(arena, entry.name, std.math.maxInt(u32));
+                try deps.addIn(path, entry.name);
+                const documents = tbd.parse(arena, text) catch |err| {
+                    std.log.err("{s}/{s}: {s}", .{ path, entry.name, @errorName(err) });
+                    std.process.exit(1);
+                };
+                var data = std.ArrayList(u8).init(arena);
+                try tbd.writeJson(arena, documents, data.writer());
+                try dst.writeFile(.{ .sub_path = entry.name, .data = data.items });
+            },
+            else => {},
+        }
+    }
+}
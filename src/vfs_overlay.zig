@@ -0,0 +1,77 @@
+//! Writes a clang VFS overlay that places every module map under
+//! `<modules-dir>/<sub>/` at the same relative path under the directory
+//! given for `<sub>`, e.g. `Frameworks=/path/to/sdk/Frameworks`. This
+//! lets clang find our module maps without modifying Apple's files.
+//!
+//! Usage: vfs_overlay <out.yaml> <modules-dir> <sub>=<dir>...
+const std = @import("std");
+
+const Overlay = struct {
+    version: u32 = 0,
+
+    /// Clang must see the module maps at their place in the SDK so that
+    /// the headers they name resolve against the SDK.
+    @"use-external-names": bool = false,
+    roots: []const Root,
+};
+
+const Root = struct {
+    type: []const u8 = "directory",
+    name: []const u8,
+    contents: []const File,
+};
+
+const File = struct {
+    type: []const u8 = "file",
+    name: []const u8 = "module.modulemap",
+    @"external-contents": []const u8,
+};
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 3) {
+        std.log.err("usage: {s} <out.yaml> <modules-dir> <sub>=<dir>...", .{args[0]});
+        std.process.exit(1);
+    }
+
+    // Paths are made absolute but not resolved: clang looks module maps
+    // up under the search paths exactly as it was given them.
+    const cwd = try std.process.getCwdAlloc(arena);
+    const modules = try std.fs.path.resolve(arena, &.{ cwd, args[2] });
+
+    var roots = std.ArrayList(Root).init(arena);
+    for (args[3..]) |mapping| {
+        const eq = std.mem.indexOfScalar(u8, mapping, '=') orelse {
+            std.log.err("expected <sub>=<dir>, got '{s}'", .{mapping});
+            std.process.exit(1);
+        };
+        const src = try std.fs.path.join(arena, &.{ modules, mapping[0..eq] });
+        const dest = try std.fs.path.resolve(arena, &.{ cwd, mapping[eq + 1 ..] });
+
+        var dir = try std.fs.openDirAbsolute(src, .{ .iterate = true });
+        defer dir.close();
+        var walker = try dir.walk(arena);
+        defer walker.deinit();
+        while (try walker.next()) |entry| {
+            if (entry.kind != .file) continue;
+            if (!std.mem.eql(u8, entry.basename, "module.modulemap")) continue;
+
+            const files = try arena.alloc(File, 1);
+            files[0] = .{ .@"external-contents" = try std.fs.path.join(arena, &.{ src, entry.path }) };
+            try roots.append(.{
+                .name = try std.fs.path.join(arena, &.{ dest, std.fs.path.dirname(entry.path) orelse "" }),
+                .contents = files,
+            });
+        }
+    }
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+    var buf = std.io.bufferedWriter(file.writer());
+    try std.json.stringify(Overlay{ .roots = roots.items }, .{ .whitespace = .indent_2 }, buf.writer());
+    try buf.flush();
+}
@@ -10,6 +10,7 @@ libs="$sdk/usr/lib"
 rm -rf Frameworks/
 rm -rf include/
 rm -rf lib/
+rm -rf modules/
 
 mkdir -p ./Frameworks
 mkdir -p ./include
@@ -78,10 +79,43 @@ rm -rf Frameworks/IOKit.framework/Versions/A/Headers/usb
 cat ./Frameworks/Foundation.framework/Versions/C/Foundation.tbd | grep -v 'libswiftFoundation' > tmp
 mv tmp ./Frameworks/Foundation.framework/Versions/C/Foundation.tbd
 
-# 13M -> 368K
-# This is commented because I now use the Mach headers but we can probably
-# prune more of this out to lower the size.
-# find ./Frameworks/Kernel.framework -type f | grep -v IOKit/hidsystem | xargs rm -rf
+# 15M -> 2.6M
+# Kernel.framework is for kernel extensions, but user space includes a few
+# of its directories. Keep what those reach on either architecture (clang
+# -H lists every header opened) and drop the rest: DriverKit .iig files,
+# MIG .defs, Exclaves... Then check that each of their headers compiles
+# for the same architectures as before.
+kernel=./Frameworks/Kernel.framework
+kernel_roots=(IOKit/hidsystem mach libkern)
+kernel_headers=$(cd "$kernel/Headers" && find "${kernel_roots[@]}" -name '*.h' | sort)
+kernel_keep=$(mktemp)
+
+# Prints "<arch> <header>" for each root header that compiles, and lists
+# the Kernel.framework files they open in $kernel_keep.
+kernel_check() {
+  for arch in arm64 x86_64; do
+    for header in $kernel_headers; do
+      if output=$(xcrun clang -arch "$arch" -fsyntax-only -Wno-everything -H -nostdlibinc \
+          -iframework ./Frameworks -isystem ./include -x c - <<< "#include <Kernel/$header>" 2>&1); then
+        echo "$arch $header"
+      fi
+      awk '/^\.+ / { print $2 }' <<< "$output" |
+        grep "^$kernel/Headers/" |
+        sed "s#^$kernel/Headers/#$kernel/Versions/A/Headers/#" >> "$kernel_keep" || true
+    done
+  done
+}
+
+kernel_before=$(kernel_check)
+find "$kernel" -type f | grep -vxFf <(sort -u "$kernel_keep") | xargs rm -f
+find "$kernel" -type d -empty -delete
+kernel_after=$(kernel_check)
+rm "$kernel_keep"
+if [ "$kernel_before" != "$kernel_after" ]; then
+  echo "Trimming Kernel.framework broke these headers:" >&2
+  comm -23 <(echo "$kernel_before") <(echo "$kernel_after") >&2
+  exit 1
+fi
 
 # 29M -> 28M
 find . | grep '\.apinotes' | xargs rm -rf
@@ -99,3 +133,85 @@ rm ./Frameworks/CloudKit.framework/Versions/A/CloudKit.tbd
 
 # Remove all broken symlinks
 find . -type l ! -exec test -e {} \; -exec rm {} ';'
+
+# Module maps. Apple's name the Swift overlays and API notes removed above,
+# so we generate our own into modules/, which build.zig maps over the SDK
+# with a clang VFS overlay. Frameworks without an umbrella header get an
+# umbrella directory minus the headers that do not compile on their own
+# (mostly the IOKit families trimmed above).
+cc=(xcrun clang -fsyntax-only -Wno-everything -nostdlibinc -iframework ./Frameworks -isystem ./include)
+darwin_headers=$(mktemp)
+
+for framework in ./Frameworks/*.framework; do
+  name=$(basename "$framework" .framework)
+
+  # Kernel extension headers are not usable from user space
+  if [ "$name" = Kernel ]; then continue; fi
+
+  map="./modules/Frameworks/$name.framework/Modules/module.modulemap"
+  mkdir -p "$(dirname "$map")"
+
+  if [ -f "$framework/Headers/$name.h" ]; then
+    headers=("$name/$name.h")
+    printf 'framework module %s [system] [extern_c] {\n  umbrella header "%s.h"\n\n  export *\n  module * { export * }\n}\n' \
+      "$name" "$name" > "$map"
+  else
+    headers=()
+    excludes=""
+    while read -r header; do
+      if "${cc[@]}" -x objective-c - <<< "#include <$name/$header>" 2>/dev/null; then
+        headers+=("$name/$header")
+      else
+        excludes+="  exclude header \"$header\"\n"
+      fi
+    done < <(cd "$framework/Headers" && find . -name '*.h' | sed 's#^\./##' | sort)
+    printf 'framework module %s [system] [extern_c] {\n  umbrella "Headers"\n%b\n  export *\n}\n' \
+      "$name" "$excludes" > "$map"
+  fi
+
+  # The include/ headers that frameworks include directly make up the
+  # Darwin module. With -H, clang prints every header it opens prefixed
+  # by one dot per level of nesting. Umbrellas that fail (AudioToolbox
+  # needs CoreMIDI, which we do not ship) still report what they opened.
+  printf '#include <%s>\n' "${headers[@]}" |
+    "${cc[@]}" -H -x objective-c - 2>&1 |
+    awk '/^\.+ / {
+      depth = length($1)
+      parent[depth] = $2
+      if ($2 ~ /^\.\/include\// && parent[depth - 1] ~ /^\.\/Frameworks\//) print substr($2, 11)
+    }' >> "$darwin_headers" || true
+done
+
+# include/_modules holds the shims Apple's module maps name: _X.h may only
+# be built as part of Darwin and _X_h.h as part of the module X_h, and
+# each includes the libc headers it stands for. Darwin owns those headers
+# too, so every module name resolves to the one definition in Darwin
+# rather than each module parsing its own copy. Headers that clang's
+# resource directory provides (stdarg.h, stdbool.h, ...) are left to
+# clang's own module map.
+shims=$(mktemp)
+for shim in ./include/_modules/*.h; do
+  module=$(sed -n 's/^#if !__building_module(\(.*\))$/\1/p' "$shim")
+  echo "$module ${shim#./include/}" >> "$shims"
+  sed -n 's/^#include <\(.*\)>$/\1/p' "$shim" | while read -r header; do
+    if [ -f "./include/$header" ]; then echo "$header"; fi
+  done >> "$darwin_headers"
+done
+
+mkdir -p ./modules/include
+{
+  printf 'module Darwin [system] [extern_c] {\n'
+  sort -u "$darwin_headers" | sed 's/.*/  header "&"/'
+  printf '\n  export *\n'
+  awk '$1 == "Darwin" {
+    name = $2; sub(/^_modules\/_/, "", name); sub(/\.h$/, "", name)
+    printf "\n  module %s {\n    header \"%s\"\n    export *\n  }\n", name, $2
+  }' "$shims"
+  printf '}\n'
+  awk '$1 != "Darwin" { print $1 }' "$shims" | sort -u | while read -r module; do
+    printf '\nmodule %s [system] [extern_c] {\n' "$module"
+    awk -v m="$module" '$1 == m { printf "  header \"%s\"\n", $2 }' "$shims"
+    printf '  export *\n}\n'
+  done
+} > ./modules/include/module.modulemap
+rm "$darwin_headers" "$shims"
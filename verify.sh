@@ -3,3 +3,5 @@ set -euo pipefail
 
 ./update.sh
 git diff
+zig build test verify-stripped verify-availability verify-groups verify-tbd-v5 \
+    verify-objc-refs verify-objc-shims verify-blocks stubs tbd-index